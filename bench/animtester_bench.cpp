@@ -0,0 +1,270 @@
+/**
+ * @file animtester_bench.cpp
+ * @date 16-Oct-2026
+ */
+
+// Microbenchmarks for the editor's hot paths. The editor is compiled into
+// this translation unit so its internals can be called directly.
+#define __animtesterBENCH__
+#include "../src/animtester.cpp"
+
+namespace bench
+{
+    struct Result
+    {
+        const orxCHAR *name;
+        orxU32 animationCount;
+        orxU32 iterations;
+        orxDOUBLE meanTime;
+        orxDOUBLE minTime;
+    };
+
+    std::vector<Result> results{};
+    orxFLOAT minTime = orxFLOAT_0;
+    orxU32 minIterations = 0;
+
+    // Repeat job until both minIterations and minTime are reached
+    template <typename F>
+    void Measure(const orxCHAR *name, orxU32 animationCount, F &&job)
+    {
+        orxU32 iterations = 0;
+        orxDOUBLE total = orxDOUBLE_0;
+        orxDOUBLE best = orxDOUBLE_0;
+        auto begin = orxSystem_GetTime();
+        while (iterations < minIterations || orxSystem_GetTime() - begin < minTime)
+        {
+            auto start = orxSystem_GetTime();
+            job();
+            auto time = orxSystem_GetTime() - start;
+            best = iterations == 0 ? time : orxMIN(best, time);
+            total += time;
+            iterations++;
+        }
+        results.push_back({name, animationCount, iterations, total / iterations, best});
+        orxLOG("%-24s %6u animations: %10.3f us mean, %10.3f us min over %u iterations", name, animationCount, total * 1e6 / iterations, best * 1e6, iterations);
+    }
+
+    // Write an animation set with animationCount single frame animations,
+    // each linking to the next one, and an object using it
+    void CreateSections(orxU32 animationCount, orxSTRING objectName, size_t objectNameSize)
+    {
+        orxCHAR setName[64], prefix[64];
+        orxString_NPrint(setName, sizeof(setName), "BenchAnimationSet%u", animationCount);
+        orxString_NPrint(prefix, sizeof(prefix), "Bench%u", animationCount);
+        orxString_NPrint(objectName, objectNameSize, "BenchObject%u", animationCount);
+
+        orxConfig_PushSection("Bench");
+        auto texture = orxConfig_GetString("Texture");
+        orxVECTOR frameSize, textureSize;
+        orxConfig_GetVector("FrameSize", &frameSize);
+        orxConfig_GetVector("TextureSize", &textureSize);
+        orxConfig_PopSection();
+        auto columns = orxMAX(1u, (orxU32)(textureSize.fX / frameSize.fX));
+        auto cells = orxMAX(1u, columns * (orxU32)(textureSize.fY / frameSize.fY));
+
+        orxConfig_PushSection(setName);
+        orxConfig_SetString("Texture", texture);
+        orxConfig_SetVector("FrameSize", &frameSize);
+        orxConfig_SetFloat("KeyDuration", 0.1f);
+        orxConfig_SetString("Prefix", prefix);
+        orxConfig_SetString("StartAnimList", "Anim0");
+        for (orxU32 i = 0; i < animationCount; i++)
+        {
+            orxCHAR anim[32], next[32];
+            orxString_NPrint(anim, sizeof(anim), "Anim%u", i);
+            orxString_NPrint(next, sizeof(next), "Anim%u", (i + 1) % animationCount);
+            auto link = config::GetAnimLinkSource(anim);
+            orxConfig_SetU32(anim, 1);
+            const orxSTRING links[] = {anim, next};
+            orxConfig_SetListString(link, links, 2);
+        }
+        orxConfig_PopSection();
+
+        for (orxU32 i = 0; i < animationCount; i++)
+        {
+            orxCHAR section[96];
+            orxString_NPrint(section, sizeof(section), "%sAnim%u", prefix, i);
+            orxConfig_PushSection(section);
+            orxVECTOR origin;
+            orxVector_Set(&origin, (i % cells % columns) * frameSize.fX, (i % cells / columns) * frameSize.fY, orxFLOAT_0);
+            orxConfig_SetVector("TextureOrigin", &origin);
+            orxConfig_PopSection();
+        }
+
+        orxConfig_PushSection(objectName);
+        orxConfig_SetString("AnimationSet", setName);
+        orxConfig_PopSection();
+    }
+
+    void Run(orxU32 animationCount, const orxSTRING saveFile)
+    {
+        orxCHAR objectName[64];
+        CreateSections(animationCount, objectName, sizeof(objectName));
+        auto object = orxObject_CreateFromConfig(objectName);
+        orxASSERT(object);
+        auto setName = object::GetAnimSetName(object);
+
+        Measure("animset::GetAnims", animationCount, [&]()
+                { animset::GetAnims(object::GetAnimSet(object), orxFALSE); });
+        Measure("animset::GetAnims/sorted", animationCount, [&]()
+                { animset::GetAnims(object::GetAnimSet(object), orxTRUE); });
+
+        // Whole set per iteration
+        const auto &names = animset::GetIndex(object::GetAnimSet(object)).names;
+        std::vector<const orxCHAR *> dests{};
+        Measure("config::GetAnimLinks", animationCount, [&]()
+                {
+                    for (auto name : names)
+                        config::GetAnimLinks(setName, name, dests);
+                });
+        const auto &linkSources = animset::GetIndex(object::GetAnimSet(object)).linkSources;
+        Measure("config::GetLinks/interned", animationCount, [&]()
+                {
+                    for (auto linkSource : linkSources)
+                        config::GetLinks(setName, linkSource, dests);
+                });
+        std::vector<std::vector<std::string>> links(names.size());
+        for (size_t i = 0; i < names.size(); i++)
+        {
+            config::GetAnimLinks(setName, names[i], dests);
+            links[i].assign(dests.begin(), dests.end());
+        }
+        Measure("config::SetAnimLinks", animationCount, [&]()
+                {
+                    for (size_t i = 0; i < names.size(); i++)
+                        config::SetAnimLinks(setName, names[i], links[i]);
+                });
+
+        // Loaded once per set by the UI, which then reads from it
+        Measure("model::Get/load", animationCount, [&]()
+                {
+                    model::Invalidate();
+                    model::Get(object::GetAnimSet(object));
+                });
+
+        // Built once per set, then every reachability query is a lookup
+        Measure("graph::Build", animationCount, [&]()
+                {
+                    graph::Graph built{};
+                    graph::Build(object::GetAnimSet(object), built);
+                });
+
+        // Patching and queueing only, the write happens on a worker. Every
+        // section is compared against the file, only the first save appends.
+        const auto &sectionNames = animset::GetIndex(object::GetAnimSet(object)).sectionNames;
+        Measure("config::Save/whole set", animationCount, [&]()
+                {
+                    config::MarkSectionDirty(setName);
+                    for (auto section : sectionNames)
+                        config::MarkSectionDirty(section);
+                    config::Save(saveFile, object);
+                });
+        orxU32 edit = 0;
+        Measure("config::Save/one key", animationCount, [&]()
+                {
+                    orxConfig_PushSection(sectionNames[0]);
+                    orxConfig_SetFloat("KeyDuration", 0.1f + 0.01f * (edit++ % 2));
+                    orxConfig_PopSection();
+                    config::MarkDirty(sectionNames[0], "KeyDuration");
+                    config::Save(saveFile, object);
+                });
+
+        Measure("rebuild::Apply", animationCount, [&]()
+                {
+                    rebuild::MarkStructural();
+                    object = rebuild::Apply(object);
+                });
+
+        Measure("gui frame", animationCount, [&]()
+                {
+                    orxImGui_BeginFrame(orxNULL);
+                    gui::ObjectWindow(object);
+                    gui::AnimSetWindow(object::GetAnimSet(object));
+                    orxImGui_EndFrame(orxNULL);
+                });
+        save.reset();
+
+        orxObject_Delete(object);
+        animset::InvalidateIndices();
+        model::Invalidate();
+    }
+
+    void Report(const orxSTRING output)
+    {
+#if defined(__orxDEBUG__)
+        const orxCHAR *build = "debug";
+#elif defined(__orxPROFILER__)
+        const orxCHAR *build = "profile";
+#else
+        const orxCHAR *build = "release";
+#endif
+        std::string out = "{\n  \"build\": \"";
+        out += build;
+        out += "\",\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const auto &result = results[i];
+            orxCHAR line[256];
+            orxString_NPrint(line, sizeof(line), "%s\n    {\"name\": \"%s\", \"animations\": %u, \"iterations\": %u, \"mean_us\": %.3f, \"min_us\": %.3f}",
+                             i > 0 ? "," : "", result.name, result.animationCount, result.iterations, result.meanTime * 1e6, result.minTime * 1e6);
+            out += line;
+        }
+        out += "\n  ]\n}\n";
+
+        auto file = *output != orxCHAR_NULL ? std::fopen(output, "wb") : stdout;
+        if (file == nullptr)
+        {
+            orxLOG("Can't write benchmark results to %s", output);
+            return;
+        }
+        std::fwrite(out.data(), 1, out.size(), file);
+        if (file != stdout)
+            std::fclose(file);
+    }
+
+    orxSTATUS orxFASTCALL Init()
+    {
+        // Same setup as the editor, then run everything before the first frame
+        ::Init();
+
+        orxConfig_PushSection("Bench");
+        minTime = orxConfig_GetFloat("MinTime");
+        minIterations = orxMAX(1u, orxConfig_GetU32("MinIterations"));
+        const orxSTRING saveFile = orxString_Store(orxConfig_GetString("SaveFile"));
+        const orxSTRING output = orxString_Store(orxConfig_GetString("Output"));
+        std::vector<orxU32> animationCounts{};
+        for (orxS32 i = 0, count = orxConfig_GetListCount("AnimationCountList"); i < count; i++)
+            animationCounts.push_back(orxConfig_GetListU32("AnimationCountList", i));
+        orxConfig_PopSection();
+
+        for (auto animationCount : animationCounts)
+            Run(animationCount, saveFile);
+        Report(output);
+
+        return orxSTATUS_SUCCESS;
+    }
+
+    orxSTATUS orxFASTCALL Run()
+    {
+        // Done after the first frame
+        return orxSTATUS_FAILURE;
+    }
+
+    orxSTATUS orxFASTCALL Bootstrap()
+    {
+        ::Bootstrap();
+
+        // Load the bench settings whatever the executable's suffix
+        orxConfig_Load("animtester_bench.ini");
+        return orxSTATUS_FAILURE;
+    }
+}
+
+/** Main function
+ */
+int main(int argc, char **argv)
+{
+    orxConfig_SetBootstrap(bench::Bootstrap);
+    orx_Execute(argc, argv, bench::Init, bench::Run, Exit);
+    return EXIT_SUCCESS;
+}
@@ -278,6 +278,59 @@ project "animtester"
         postbuildcommands {"cp -f $(ORX)/lib/dynamic/liborx*.dylib " .. copybase .. "/bin"}
 
 
+-- Windows
+
+    configuration {"windows"}
+        postbuildcommands {"cmd /c copy /Y $(ORX)\\lib\\dynamic\\orx*.dll " .. path.translate(copybase, "\\") .. "\\bin"}
+
+--
+-- Project: animtester_bench
+--
+
+project "animtester_bench"
+
+    files
+    {
+        "../bench/**.cpp",
+        "../src/imgui/**.cpp",
+        "../include/**.h",
+        "../data/config/**.ini"
+    }
+
+    includedirs
+    {
+        "../include/imgui",
+        "../include"
+    }
+
+    configuration {"windows", "vs*"}
+        buildoptions {"/EHsc"}
+
+    -- Results are printed to the console
+    configuration {"windows"}
+        kind ("ConsoleApp")
+
+    vpaths
+    {
+        ["config"] = {"**.ini"}
+    }
+
+
+-- Linux
+
+    configuration {"linux"}
+        postbuildcommands {"cp -f $(ORX)/lib/dynamic/liborx*.so " .. copybase .. "/bin"}
+
+
+-- Mac OS X
+
+    configuration {"macosx", "xcode*"}
+        postbuildcommands {"cp -f /Users/hcarty/projects/orx/code/lib/dynamic/liborx*.dylib " .. copybase .. "/bin"}
+
+    configuration {"macosx", "not xcode*"}
+        postbuildcommands {"cp -f $(ORX)/lib/dynamic/liborx*.dylib " .. copybase .. "/bin"}
+
+
 -- Windows
 
     configuration {"windows"}
@@ -14,13 +14,60 @@
 #define orxIMGUI_KZ_CONFIG_SECTION          "ImGui"
 #define orxIMGUI_KZ_CONFIG_FONT_LIST        "FontList"
 
+#define orxIMGUI_KZ_CONFIG_ALLOCATOR        "Allocator"
+
+#define orxIMGUI_KZ_CONFIG_RECORD           "Record"
+#define orxIMGUI_KZ_CONFIG_REPLAY           "Replay"
+#define orxIMGUI_KZ_CONFIG_REPLAY_DELTA_TIME "ReplayDeltaTime"
+#define orxIMGUI_KZ_CONFIG_QUIT_AFTER_REPLAY "QuitAfterReplay"
+
+#define orxIMGUI_KZ_ALLOCATOR_SYSTEM        "System"
+#define orxIMGUI_KZ_ALLOCATOR_TIERED        "Tiered"
+
 #define orxIMGUI_KU32_DEFAULT_FONT_SIZE     13.0f
+#define orxIMGUI_KF_DEFAULT_DT              (1.0f / 60.0f)  // When the core clock hasn't advanced
+#define orxIMGUI_KF_DEFAULT_REPLAY_DT       (1.0f / 60.0f)
+
+#define orxIMGUI_KU32_LOG_MAGIC             0x524D494F  // 'OIMR'
+#define orxIMGUI_KU32_LOG_VERSION           1
+#define orxIMGUI_KU32_LOG_TEXT_SIZE         1024        // Text input recorded per frame, terminator included
+
+#define orxIMGUI_KU32_BLOCK_HEADER_SIZE     16
+#define orxIMGUI_KU32_ARENA_SIZE            (256 * 1024)
+#define orxIMGUI_KU32_ARENA_PINNED_FRAMES   8     // Frames the arena can stay in use before being bypassed
+#define orxIMGUI_KU32_POOL_MIN_BLOCK_SIZE   32u
+#define orxIMGUI_KU32_POOL_CLASS_NUMBER     8     // 32 to 4096 bytes, header included
+#define orxIMGUI_KU32_POOL_PAGE_SIZE        (64 * 1024)
+
+typedef enum __orxIMGUI_ALLOCATOR_t
+{
+  orxIMGUI_ALLOCATOR_SYSTEM = 0,
+  orxIMGUI_ALLOCATOR_TIERED,
+
+  orxIMGUI_ALLOCATOR_NUMBER
+
+} orxIMGUI_ALLOCATOR;
+
+typedef void (orxFASTCALL *orxIMGUI_TRACE_FUNCTION)(const orxSTRING _zName, orxDOUBLE _dStartTime, orxDOUBLE _dEndTime);
 
 typedef struct __orxIMGUI_t
 {
   ImFont                                   *pstDefaultFont;
   ImFont                                  **apstFonts;
   orxS32                                    s32FontCount;
+  orxU32                                    u32FrameAllocationCount;
+  orxU32                                    u32FrameAllocationSize;
+  orxU32                                    u32LastFrameAllocationCount;
+  orxU32                                    u32LastFrameAllocationSize;
+  orxIMGUI_ALLOCATOR                        eAllocator;
+  orxDOUBLE                                 dFrameAllocatorTime;
+  orxDOUBLE                                 dLastFrameAllocatorTime;
+  orxU32                                    u32CommandCount;
+  orxU32                                    u32DrawCallCount;
+  orxU32                                    u32CulledTriangleCount;
+  orxBOOL                                   bInputChanged;
+  orxBOOL                                   bTimeAllocator;   // Fills dFrameAllocatorTime, off by default as it costs two clock reads per call
+  orxIMGUI_TRACE_FUNCTION                   pfnTrace;         // Optional, receives the backend's frame phase timings
 
 } orxIMGUI;
 
@@ -28,6 +75,19 @@ extern      orxIMGUI                        sstImGui;
 
 orxSTATUS   orxFASTCALL                     orxImGui_Init();
 void        orxFASTCALL                     orxImGui_Exit();
+orxBOOL     orxFASTCALL                     orxImGui_HasPendingInput();
+
+orxSTATUS   orxFASTCALL                     orxImGui_StartRecording(const orxSTRING _zFileName);
+void        orxFASTCALL                     orxImGui_StopRecording();
+orxSTATUS   orxFASTCALL                     orxImGui_StartReplay(const orxSTRING _zFileName, orxFLOAT _fDeltaTime);
+void        orxFASTCALL                     orxImGui_StopReplay();
+orxBOOL     orxFASTCALL                     orxImGui_IsReplaying();
+
+// Dear ImGui allocations made between these calls must be freed before the next frame begins:
+// meant for temporaries such as ImGuiTextBuffer, keep widget calls out as they can grow
+// long-lived draw list buffers
+void        orxFASTCALL                     orxImGui_PushFrameAllocations();
+void        orxFASTCALL                     orxImGui_PopFrameAllocations();
 
 
 //! Code
@@ -38,14 +98,335 @@ static orxBOOL sbImGuiInFrame               = orxFALSE;
 
 orxIMGUI sstImGui                           = {};
 
+typedef enum __orxIMGUI_TIER_t
+{
+  orxIMGUI_TIER_SYSTEM = 0,
+  orxIMGUI_TIER_ARENA,
+  orxIMGUI_TIER_POOL
+
+} orxIMGUI_TIER;
+
+// Stored in front of every block handed to Dear ImGui, keeps blocks 16-byte aligned
+typedef struct __orxIMGUI_BLOCK_HEADER_t
+{
+  orxU32                                    u32Tier;
+  orxU32                                    u32Class;
+  orxU8                                     au8Padding[orxIMGUI_KU32_BLOCK_HEADER_SIZE - 2 * sizeof(orxU32)];
+
+} orxIMGUI_BLOCK_HEADER;
+
+typedef struct __orxIMGUI_FREE_BLOCK_t
+{
+  struct __orxIMGUI_FREE_BLOCK_t           *pstNext;
+
+} orxIMGUI_FREE_BLOCK;
+
+// Tiered allocator: a bump arena, reset when a new frame begins, serves requests made
+// inside orxImGui_Push/PopFrameAllocations; size-class pools serve long-lived draw list
+// and window storage; anything larger goes to orx's allocator
+typedef struct __orxIMGUI_ALLOCATOR_STATE_t
+{
+  orxU8                                    *pu8Arena;
+  orxU32                                    u32ArenaOffset;
+  orxU32                                    u32ArenaLiveCount;
+  orxU32                                    u32ArenaPinnedFrames;
+  orxBOOL                                   bArenaBypassed;
+  orxU32                                    u32FrameScopeCount;
+
+  orxIMGUI_FREE_BLOCK                      *apstFreeList[orxIMGUI_KU32_POOL_CLASS_NUMBER];
+  void                                     *pFirstPage;
+  orxU8                                    *pu8PageCursor;
+  orxU32                                    u32PageRemaining;
+
+} orxIMGUI_ALLOCATOR_STATE;
+
+static orxIMGUI_ALLOCATOR_STATE sstImGuiAllocator = {};
+
+static void *orxImGui_AllocatePoolBlock(orxU32 _u32Class)
+{
+  orxU32 u32BlockSize = orxIMGUI_KU32_POOL_MIN_BLOCK_SIZE << _u32Class;
+  void  *pResult;
+
+  if(sstImGuiAllocator.apstFreeList[_u32Class] != orxNULL)
+  {
+    pResult = sstImGuiAllocator.apstFreeList[_u32Class];
+    sstImGuiAllocator.apstFreeList[_u32Class] = sstImGuiAllocator.apstFreeList[_u32Class]->pstNext;
+  }
+  else
+  {
+    if(sstImGuiAllocator.u32PageRemaining < u32BlockSize)
+    {
+      // Pages are chained through their first header-sized bytes and only released on exit
+      orxU8 *pu8Page = (orxU8 *)orxMemory_Allocate(orxIMGUI_KU32_POOL_PAGE_SIZE, orxMEMORY_TYPE_TEMP);
+      if(pu8Page == orxNULL)
+      {
+        return orxNULL;
+      }
+      *(void **)pu8Page = sstImGuiAllocator.pFirstPage;
+      sstImGuiAllocator.pFirstPage = pu8Page;
+      sstImGuiAllocator.pu8PageCursor = pu8Page + orxIMGUI_KU32_BLOCK_HEADER_SIZE;
+      sstImGuiAllocator.u32PageRemaining = orxIMGUI_KU32_POOL_PAGE_SIZE - orxIMGUI_KU32_BLOCK_HEADER_SIZE;
+    }
+    pResult = sstImGuiAllocator.pu8PageCursor;
+    sstImGuiAllocator.pu8PageCursor += u32BlockSize;
+    sstImGuiAllocator.u32PageRemaining -= u32BlockSize;
+  }
+
+  return pResult;
+}
+
 static void *orxImGui_Allocate(size_t _sSize, void *)
 {
-  return orxMemory_Allocate((orxU32)_sSize, orxMEMORY_TYPE_TEMP);
+  orxDOUBLE               dStart = (sstImGui.bTimeAllocator != orxFALSE) ? orxSystem_GetTime() : orxDOUBLE_0;
+  orxIMGUI_BLOCK_HEADER  *pstHeader = orxNULL;
+  orxU32                  u32Size = (orxU32)_sSize + orxIMGUI_KU32_BLOCK_HEADER_SIZE;
+
+  sstImGui.u32FrameAllocationCount++;
+  sstImGui.u32FrameAllocationSize += (orxU32)_sSize;
+
+  if(sstImGui.eAllocator == orxIMGUI_ALLOCATOR_TIERED)
+  {
+    // Frame arena, only for callers which vouch for the lifetime of their allocations
+    orxU32 u32AlignedSize = (u32Size + orxIMGUI_KU32_BLOCK_HEADER_SIZE - 1) & ~(orxIMGUI_KU32_BLOCK_HEADER_SIZE - 1);
+    if((sstImGuiAllocator.u32FrameScopeCount > 0)
+    && (sstImGuiAllocator.bArenaBypassed == orxFALSE)
+    && (sstImGuiAllocator.u32ArenaOffset + u32AlignedSize <= orxIMGUI_KU32_ARENA_SIZE))
+    {
+      if(sstImGuiAllocator.pu8Arena == orxNULL)
+      {
+        sstImGuiAllocator.pu8Arena = (orxU8 *)orxMemory_Allocate(orxIMGUI_KU32_ARENA_SIZE, orxMEMORY_TYPE_TEMP);
+      }
+      if(sstImGuiAllocator.pu8Arena != orxNULL)
+      {
+        pstHeader = (orxIMGUI_BLOCK_HEADER *)(sstImGuiAllocator.pu8Arena + sstImGuiAllocator.u32ArenaOffset);
+        pstHeader->u32Tier = orxIMGUI_TIER_ARENA;
+        sstImGuiAllocator.u32ArenaOffset += u32AlignedSize;
+        sstImGuiAllocator.u32ArenaLiveCount++;
+      }
+    }
+
+    // Size-class pools
+    if(pstHeader == orxNULL)
+    {
+      orxU32 u32Class;
+      for(u32Class = 0; (u32Class < orxIMGUI_KU32_POOL_CLASS_NUMBER) && ((orxIMGUI_KU32_POOL_MIN_BLOCK_SIZE << u32Class) < u32Size); u32Class++);
+      if(u32Class < orxIMGUI_KU32_POOL_CLASS_NUMBER)
+      {
+        pstHeader = (orxIMGUI_BLOCK_HEADER *)orxImGui_AllocatePoolBlock(u32Class);
+        if(pstHeader != orxNULL)
+        {
+          pstHeader->u32Tier  = orxIMGUI_TIER_POOL;
+          pstHeader->u32Class = u32Class;
+        }
+      }
+    }
+  }
+
+  if(pstHeader == orxNULL)
+  {
+    pstHeader = (orxIMGUI_BLOCK_HEADER *)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_TEMP);
+    if(pstHeader == orxNULL)
+    {
+      return orxNULL;
+    }
+    pstHeader->u32Tier = orxIMGUI_TIER_SYSTEM;
+  }
+
+  if(sstImGui.bTimeAllocator != orxFALSE)
+  {
+    sstImGui.dFrameAllocatorTime += orxSystem_GetTime() - dStart;
+  }
+
+  return (orxU8 *)pstHeader + orxIMGUI_KU32_BLOCK_HEADER_SIZE;
 }
 
 static void orxImGui_Free(void *_pData, void *)
 {
-  orxMemory_Free(_pData);
+  if(_pData != orxNULL)
+  {
+    orxDOUBLE               dStart = (sstImGui.bTimeAllocator != orxFALSE) ? orxSystem_GetTime() : orxDOUBLE_0;
+    orxIMGUI_BLOCK_HEADER  *pstHeader = (orxIMGUI_BLOCK_HEADER *)((orxU8 *)_pData - orxIMGUI_KU32_BLOCK_HEADER_SIZE);
+
+    // Blocks are released to the tier they came from, whatever the current allocator
+    switch(pstHeader->u32Tier)
+    {
+      case orxIMGUI_TIER_ARENA:
+      {
+        sstImGuiAllocator.u32ArenaLiveCount--;
+        break;
+      }
+      case orxIMGUI_TIER_POOL:
+      {
+        orxIMGUI_FREE_BLOCK *pstBlock = (orxIMGUI_FREE_BLOCK *)pstHeader;
+        orxU32 u32Class = pstHeader->u32Class;
+        pstBlock->pstNext = sstImGuiAllocator.apstFreeList[u32Class];
+        sstImGuiAllocator.apstFreeList[u32Class] = pstBlock;
+        break;
+      }
+      default:
+      {
+        orxMemory_Free(pstHeader);
+        break;
+      }
+    }
+
+    if(sstImGui.bTimeAllocator != orxFALSE)
+    {
+      sstImGui.dFrameAllocatorTime += orxSystem_GetTime() - dStart;
+    }
+  }
+}
+
+static void orxImGui_ResetArena()
+{
+  if(sstImGuiAllocator.u32ArenaLiveCount == 0)
+  {
+    sstImGuiAllocator.u32ArenaOffset        = 0;
+    sstImGuiAllocator.u32ArenaPinnedFrames  = 0;
+    sstImGuiAllocator.bArenaBypassed        = orxFALSE;
+  }
+  else if(++sstImGuiAllocator.u32ArenaPinnedFrames > orxIMGUI_KU32_ARENA_PINNED_FRAMES)
+  {
+    // A frame scope leaked a block, stop using the arena until it drains
+    sstImGuiAllocator.bArenaBypassed        = orxTRUE;
+  }
+}
+
+void orxFASTCALL orxImGui_PushFrameAllocations()
+{
+  sstImGuiAllocator.u32FrameScopeCount++;
+}
+
+void orxFASTCALL orxImGui_PopFrameAllocations()
+{
+  orxASSERT(sstImGuiAllocator.u32FrameScopeCount > 0);
+  sstImGuiAllocator.u32FrameScopeCount--;
+}
+
+static void orxImGui_ExitAllocator()
+{
+  while(sstImGuiAllocator.pFirstPage != orxNULL)
+  {
+    void *pNext = *(void **)sstImGuiAllocator.pFirstPage;
+    orxMemory_Free(sstImGuiAllocator.pFirstPage);
+    sstImGuiAllocator.pFirstPage = pNext;
+  }
+  if(sstImGuiAllocator.pu8Arena != orxNULL)
+  {
+    orxMemory_Free(sstImGuiAllocator.pu8Arena);
+  }
+  orxMemory_Zero(&sstImGuiAllocator, sizeof(orxIMGUI_ALLOCATOR_STATE));
+}
+
+// Consecutive draw commands sharing a texture and clip rect, merged into a single mesh
+typedef struct __orxIMGUI_BATCH_t
+{
+  ImVector<ImDrawVert>                      astVertexList;
+  ImVector<ImDrawIdx>                       au16IndexList;
+  ImTextureID                               pTexture;
+  ImVec4                                    vClipRect;
+  ImVec2                                    vDisplayPos;
+  orxBITMAP                                *pstScreen;
+
+} orxIMGUI_BATCH;
+
+static orxIMGUI_BATCH sstImGuiBatch;
+
+static void orxImGui_FlushBatch()
+{
+  if(sstImGuiBatch.au16IndexList.Size > 0)
+  {
+    // Scissor to the clip rect, in the same screen space as the vertices
+    const ImVec4 &rvClipRect = sstImGuiBatch.vClipRect;
+    orxFLOAT fLeft    = orxMAX(orxFLOAT_0, rvClipRect.x - sstImGuiBatch.vDisplayPos.x);
+    orxFLOAT fTop     = orxMAX(orxFLOAT_0, rvClipRect.y - sstImGuiBatch.vDisplayPos.y);
+    orxFLOAT fRight   = orxMAX(fLeft, rvClipRect.z - sstImGuiBatch.vDisplayPos.x);
+    orxFLOAT fBottom  = orxMAX(fTop, rvClipRect.w - sstImGuiBatch.vDisplayPos.y);
+    orxDisplay_SetBitmapClipping(sstImGuiBatch.pstScreen, (orxU32)fLeft, (orxU32)fTop, (orxU32)ceilf(fRight), (orxU32)ceilf(fBottom));
+
+    orxDISPLAY_MESH stMesh = {};
+    stMesh.ePrimitive       = orxDISPLAY_PRIMITIVE_TRIANGLES;
+    stMesh.astVertexList    = (orxDISPLAY_VERTEX *)sstImGuiBatch.astVertexList.Data;
+    stMesh.u32VertexNumber  = (orxU32)sstImGuiBatch.astVertexList.Size;
+    stMesh.au16IndexList    = sstImGuiBatch.au16IndexList.Data;
+    stMesh.u32IndexNumber   = (orxU32)sstImGuiBatch.au16IndexList.Size;
+    // Smoothing is off everywhere so that textures in GUI widgets have no smoothing applied
+    orxDisplay_DrawMesh(&stMesh, (orxBITMAP *)sstImGuiBatch.pTexture, orxDISPLAY_SMOOTHING_OFF, orxDISPLAY_BLEND_MODE_ALPHA);
+    sstImGui.u32DrawCallCount++;
+  }
+  sstImGuiBatch.astVertexList.resize(0);
+  sstImGuiBatch.au16IndexList.resize(0);
+}
+
+static orxBOOL orxImGui_IsTriangleVisible(const ImDrawVert *_pstVertices, const ImDrawIdx *_pu16Triangle, const ImVec4 &_rvClipRect)
+{
+  const ImVec2 &rvA = _pstVertices[_pu16Triangle[0]].pos;
+  const ImVec2 &rvB = _pstVertices[_pu16Triangle[1]].pos;
+  const ImVec2 &rvC = _pstVertices[_pu16Triangle[2]].pos;
+
+  // Conservative bounding box test, partially visible triangles are left to the scissor
+  return ((orxMAX(rvA.x, orxMAX(rvB.x, rvC.x)) >= _rvClipRect.x)
+       && (orxMIN(rvA.x, orxMIN(rvB.x, rvC.x)) <= _rvClipRect.z)
+       && (orxMAX(rvA.y, orxMAX(rvB.y, rvC.y)) >= _rvClipRect.y)
+       && (orxMIN(rvA.y, orxMIN(rvB.y, rvC.y)) <= _rvClipRect.w)) ? orxTRUE : orxFALSE;
+}
+
+static void orxImGui_AddCommand(const ImDrawList *_pstDrawList, const ImDrawCmd &_rstCommand)
+{
+  const ImDrawIdx  *pu16Indices = _pstDrawList->IdxBuffer.Data + _rstCommand.IdxOffset;
+  const ImDrawVert *pstVertices = _pstDrawList->VtxBuffer.Data + _rstCommand.VtxOffset;
+  const ImVec4     &rvClipRect  = _rstCommand.ClipRect;
+  orxU32            u32Min = 0xFFFF, u32Max = 0, u32KeptIndexCount = 0;
+
+  // Only the vertices of triangles overlapping the clip rect are sent
+  for(orxU32 i = 0; i + 2 < _rstCommand.ElemCount; i += 3)
+  {
+    if(orxImGui_IsTriangleVisible(pstVertices, pu16Indices + i, rvClipRect))
+    {
+      for(orxU32 j = i; j < i + 3; j++)
+      {
+        u32Min = orxMIN(u32Min, (orxU32)pu16Indices[j]);
+        u32Max = orxMAX(u32Max, (orxU32)pu16Indices[j]);
+      }
+      u32KeptIndexCount += 3;
+    }
+    else
+    {
+      sstImGui.u32CulledTriangleCount++;
+    }
+  }
+
+  if(u32KeptIndexCount == 0)
+  {
+    return;
+  }
+  orxU32 u32VertexCount = u32Max - u32Min + 1;
+
+  if((_rstCommand.TextureId != sstImGuiBatch.pTexture)
+  || (orxMemory_Compare(&rvClipRect, &sstImGuiBatch.vClipRect, sizeof(ImVec4)) != 0)
+  || ((orxU32)sstImGuiBatch.astVertexList.Size + u32VertexCount > (1 << (8 * sizeof(ImDrawIdx)))))
+  {
+    orxImGui_FlushBatch();
+    sstImGuiBatch.pTexture  = _rstCommand.TextureId;
+    sstImGuiBatch.vClipRect = rvClipRect;
+  }
+
+  orxU32 u32VertexBase  = (orxU32)sstImGuiBatch.astVertexList.Size;
+  orxU32 u32IndexBase   = (orxU32)sstImGuiBatch.au16IndexList.Size;
+  sstImGuiBatch.astVertexList.resize(u32VertexBase + u32VertexCount);
+  sstImGuiBatch.au16IndexList.resize(u32IndexBase + u32KeptIndexCount);
+  orxMemory_Copy(sstImGuiBatch.astVertexList.Data + u32VertexBase, pstVertices + u32Min, u32VertexCount * sizeof(ImDrawVert));
+  ImDrawIdx *pu16Out = sstImGuiBatch.au16IndexList.Data + u32IndexBase;
+  for(orxU32 i = 0; i + 2 < _rstCommand.ElemCount; i += 3)
+  {
+    if(orxImGui_IsTriangleVisible(pstVertices, pu16Indices + i, rvClipRect))
+    {
+      for(orxU32 j = i; j < i + 3; j++)
+      {
+        *pu16Out++ = (ImDrawIdx)(pu16Indices[j] - u32Min + u32VertexBase);
+      }
+    }
+  }
 }
 
 static const char *orxImGui_GetClipboard(void *)
@@ -58,8 +439,287 @@ static void orxImGui_SetClipboard(void *, const char *_acText)
   orxSystem_SetClipboard(_acText);
 }
 
+typedef struct __orxIMGUI_INPUT_t
+{
+  orxKEYBOARD_KEY                           aeKeyList[ImGuiKey_COUNT + 8];
+  orxU32                                    u32KeyCount;
+  ImVec2                                    vDisplaySize;
+  ImVec2                                    vFramebufferScale;
+  float                                     afNavInputs[ImGuiNavInput_COUNT];
+  orxBOOL                                   bDisplayDirty;
+  orxBOOL                                   bJoystickConnected;
+
+} orxIMGUI_INPUT;
+
+static orxIMGUI_INPUT sstImGuiInput;
+
+static void orxImGui_AddKey(orxKEYBOARD_KEY _eKey)
+{
+  for(orxU32 i = 0; i < sstImGuiInput.u32KeyCount; i++)
+  {
+    if(sstImGuiInput.aeKeyList[i] == _eKey)
+    {
+      return;
+    }
+  }
+  sstImGuiInput.aeKeyList[sstImGuiInput.u32KeyCount++] = _eKey;
+}
+
+static void orxImGui_UpdateDisplay()
+{
+  orxDisplay_GetScreenSize(&sstImGuiInput.vDisplaySize.x, &sstImGuiInput.vDisplaySize.y);
+  orxVECTOR vFramebufferSize;
+  orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+  orxConfig_GetVector(orxDISPLAY_KZ_CONFIG_FRAMEBUFFER_SIZE, &vFramebufferSize);
+  orxConfig_PopSection();
+  sstImGuiInput.vFramebufferScale.x = vFramebufferSize.fX / sstImGuiInput.vDisplaySize.x;
+  sstImGuiInput.vFramebufferScale.y = vFramebufferSize.fY / sstImGuiInput.vDisplaySize.y;
+  sstImGuiInput.bDisplayDirty = orxFALSE;
+}
+
+// Checks devices against the last state sent to ImGui, without touching it
+orxBOOL orxFASTCALL orxImGui_HasPendingInput()
+{
+  const ImGuiIO &rstIO = ImGui::GetIO();
+
+  orxVECTOR vMousePos;
+  orxMouse_GetPosition(&vMousePos);
+  if((vMousePos.fX != rstIO.MousePos.x) || (vMousePos.fY != rstIO.MousePos.y) || (orxMouse_GetWheelDelta() != orxFLOAT_0))
+  {
+    return orxTRUE;
+  }
+  for(int i = 0; i < IM_ARRAYSIZE(rstIO.MouseDown); i++)
+  {
+    if((orxMouse_IsButtonPressed((orxMOUSE_BUTTON)i) ? true : false) != rstIO.MouseDown[i])
+    {
+      return orxTRUE;
+    }
+  }
+  for(orxU32 i = 0; i < sstImGuiInput.u32KeyCount; i++)
+  {
+    orxKEYBOARD_KEY eKey = sstImGuiInput.aeKeyList[i];
+    if((orxKeyboard_IsKeyPressed(eKey) ? true : false) != rstIO.KeysDown[eKey])
+    {
+      return orxTRUE;
+    }
+  }
+  if(orxJoystick_IsConnected(1) != sstImGuiInput.bJoystickConnected)
+  {
+    return orxTRUE;
+  }
+
+  return orxFALSE;
+}
+
+// Input log: a header, then one record per frame with the IO state sent to ImGui.
+// Only keys that changed since the previous frame are stored, bit 15 tells if pressed.
+typedef struct __orxIMGUI_LOG_HEADER_t
+{
+  orxU32                                    u32Magic;
+  orxU32                                    u32Version;
+
+} orxIMGUI_LOG_HEADER;
+
+typedef struct __orxIMGUI_LOG_FRAME_t
+{
+  orxFLOAT                                  fDeltaTime;
+  orxFLOAT                                  fMouseX;
+  orxFLOAT                                  fMouseY;
+  orxFLOAT                                  fMouseWheel;
+  orxU8                                     u8MouseButtons;
+  orxU8                                     u8KeyCount;
+  orxU16                                    u16TextLength;
+  // Followed by orxU16 au16Keys[u8KeyCount] and orxCHAR acText[u16TextLength]
+
+} orxIMGUI_LOG_FRAME;
+
+typedef struct __orxIMGUI_LOG_t
+{
+  orxFILE                                  *pstRecordFile;
+  orxFILE                                  *pstReplayFile;
+  bool                                      abRecordedKeys[IM_ARRAYSIZE(ImGuiIO::KeysDown)];
+  orxCHAR                                   acReplayText[orxIMGUI_KU32_LOG_TEXT_SIZE];
+  orxFLOAT                                  fReplayDeltaTime;
+  orxBOOL                                   bQuitAfterReplay;
+  orxU32                                    u32ReplayFrameCount;
+  orxDOUBLE                                 dReplayFrameTime;
+  orxDOUBLE                                 dReplayTotalTime;
+  orxDOUBLE                                 dReplayMaxTime;
+
+} orxIMGUI_LOG;
+
+static orxIMGUI_LOG sstImGuiLog;
+
+orxSTATUS orxFASTCALL orxImGui_StartRecording(const orxSTRING _zFileName)
+{
+  orxImGui_StopRecording();
+
+  sstImGuiLog.pstRecordFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+  if(sstImGuiLog.pstRecordFile == orxNULL)
+  {
+    return orxSTATUS_FAILURE;
+  }
+
+  orxIMGUI_LOG_HEADER stHeader = {orxIMGUI_KU32_LOG_MAGIC, orxIMGUI_KU32_LOG_VERSION};
+  orxFile_Write(&stHeader, sizeof(stHeader), 1, sstImGuiLog.pstRecordFile);
+
+  // The first frame stores every pressed key
+  orxMemory_Zero(sstImGuiLog.abRecordedKeys, sizeof(sstImGuiLog.abRecordedKeys));
+
+  return orxSTATUS_SUCCESS;
+}
+
+void orxFASTCALL orxImGui_StopRecording()
+{
+  if(sstImGuiLog.pstRecordFile != orxNULL)
+  {
+    orxFile_Close(sstImGuiLog.pstRecordFile);
+    sstImGuiLog.pstRecordFile = orxNULL;
+  }
+}
+
+orxSTATUS orxFASTCALL orxImGui_StartReplay(const orxSTRING _zFileName, orxFLOAT _fDeltaTime)
+{
+  orxImGui_StopReplay();
+
+  sstImGuiLog.pstReplayFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+  if(sstImGuiLog.pstReplayFile == orxNULL)
+  {
+    return orxSTATUS_FAILURE;
+  }
+
+  orxIMGUI_LOG_HEADER stHeader;
+  if((orxFile_Read(&stHeader, sizeof(stHeader), 1, sstImGuiLog.pstReplayFile) != 1)
+  || (stHeader.u32Magic != orxIMGUI_KU32_LOG_MAGIC)
+  || (stHeader.u32Version != orxIMGUI_KU32_LOG_VERSION))
+  {
+    orxFile_Close(sstImGuiLog.pstReplayFile);
+    sstImGuiLog.pstReplayFile = orxNULL;
+    return orxSTATUS_FAILURE;
+  }
+
+  sstImGuiLog.fReplayDeltaTime    = (_fDeltaTime > orxFLOAT_0) ? _fDeltaTime : orxIMGUI_KF_DEFAULT_REPLAY_DT;
+  sstImGuiLog.u32ReplayFrameCount = 0;
+  sstImGuiLog.dReplayFrameTime    = orxDOUBLE_0;
+  sstImGuiLog.dReplayTotalTime    = orxDOUBLE_0;
+  sstImGuiLog.dReplayMaxTime      = orxDOUBLE_0;
+
+  return orxSTATUS_SUCCESS;
+}
+
+void orxFASTCALL orxImGui_StopReplay()
+{
+  if(sstImGuiLog.pstReplayFile != orxNULL)
+  {
+    orxFile_Close(sstImGuiLog.pstReplayFile);
+    sstImGuiLog.pstReplayFile = orxNULL;
+
+    if(sstImGuiLog.u32ReplayFrameCount > 1)
+    {
+      orxLOG("ImGui replay: %u frames, %.3f ms average, %.3f ms max frame time", sstImGuiLog.u32ReplayFrameCount, sstImGuiLog.dReplayTotalTime * 1e3 / (sstImGuiLog.u32ReplayFrameCount - 1), sstImGuiLog.dReplayMaxTime * 1e3);
+    }
+  }
+}
+
+orxBOOL orxFASTCALL orxImGui_IsReplaying()
+{
+  return (sstImGuiLog.pstReplayFile != orxNULL) ? orxTRUE : orxFALSE;
+}
+
+static void orxImGui_RecordFrame(const ImGuiIO &_rstIO, const orxSTRING _zText)
+{
+  orxIMGUI_LOG_FRAME  stFrame;
+  orxU16              au16Keys[256];
+
+  stFrame.fDeltaTime      = _rstIO.DeltaTime;
+  stFrame.fMouseX         = _rstIO.MousePos.x;
+  stFrame.fMouseY         = _rstIO.MousePos.y;
+  stFrame.fMouseWheel     = _rstIO.MouseWheel;
+  stFrame.u8MouseButtons  = 0;
+  for(int i = 0; i < IM_ARRAYSIZE(_rstIO.MouseDown); i++)
+  {
+    stFrame.u8MouseButtons |= _rstIO.MouseDown[i] ? (orxU8)(1 << i) : 0;
+  }
+  stFrame.u8KeyCount = 0;
+  for(orxU32 i = 0; i < sstImGuiInput.u32KeyCount; i++)
+  {
+    orxKEYBOARD_KEY eKey = sstImGuiInput.aeKeyList[i];
+    if(_rstIO.KeysDown[eKey] != sstImGuiLog.abRecordedKeys[eKey])
+    {
+      sstImGuiLog.abRecordedKeys[eKey] = _rstIO.KeysDown[eKey];
+      au16Keys[stFrame.u8KeyCount++] = (orxU16)eKey | (_rstIO.KeysDown[eKey] ? 0x8000 : 0);
+    }
+  }
+  stFrame.u16TextLength = (orxU16)orxMIN(orxString_GetLength(_zText), orxIMGUI_KU32_LOG_TEXT_SIZE - 1);
+
+  orxFile_Write(&stFrame, sizeof(stFrame), 1, sstImGuiLog.pstRecordFile);
+  orxFile_Write(au16Keys, sizeof(orxU16), stFrame.u8KeyCount, sstImGuiLog.pstRecordFile);
+  orxFile_Write(_zText, sizeof(orxCHAR), stFrame.u16TextLength, sstImGuiLog.pstRecordFile);
+}
+
+// Applies the next recorded frame and returns its text input, the replay stops at the end of the log
+static const orxSTRING orxImGui_ReplayFrame(ImGuiIO &_rstIO)
+{
+  orxIMGUI_LOG_FRAME  stFrame;
+  orxU16              au16Keys[256];
+
+  if((orxFile_Read(&stFrame, sizeof(stFrame), 1, sstImGuiLog.pstReplayFile) != 1)
+  || (orxFile_Read(au16Keys, sizeof(orxU16), stFrame.u8KeyCount, sstImGuiLog.pstReplayFile) != stFrame.u8KeyCount)
+  || (stFrame.u16TextLength >= orxIMGUI_KU32_LOG_TEXT_SIZE)
+  || (orxFile_Read(sstImGuiLog.acReplayText, sizeof(orxCHAR), stFrame.u16TextLength, sstImGuiLog.pstReplayFile) != stFrame.u16TextLength))
+  {
+    orxImGui_StopReplay();
+    if(sstImGuiLog.bQuitAfterReplay != orxFALSE)
+    {
+      orxEvent_SendShort(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_CLOSE);
+    }
+    return orxNULL;
+  }
+  sstImGuiLog.acReplayText[stFrame.u16TextLength] = orxCHAR_NULL;
+
+  // Real time spent per replayed frame, the benchmark result
+  orxDOUBLE dTime = orxSystem_GetTime();
+  if(sstImGuiLog.u32ReplayFrameCount > 0)
+  {
+    orxDOUBLE dFrameTime = dTime - sstImGuiLog.dReplayFrameTime;
+    sstImGuiLog.dReplayTotalTime += dFrameTime;
+    sstImGuiLog.dReplayMaxTime    = orxMAX(sstImGuiLog.dReplayMaxTime, dFrameTime);
+  }
+  sstImGuiLog.dReplayFrameTime = dTime;
+  sstImGuiLog.u32ReplayFrameCount++;
+
+  _rstIO.DeltaTime  = sstImGuiLog.fReplayDeltaTime;
+  _rstIO.MousePos.x = stFrame.fMouseX;
+  _rstIO.MousePos.y = stFrame.fMouseY;
+  _rstIO.MouseWheel = stFrame.fMouseWheel;
+  for(int i = 0; i < IM_ARRAYSIZE(_rstIO.MouseDown); i++)
+  {
+    _rstIO.MouseDown[i] = (stFrame.u8MouseButtons & (1 << i)) ? true : false;
+  }
+  for(orxU32 i = 0; i < stFrame.u8KeyCount; i++)
+  {
+    orxU32 u32Key = au16Keys[i] & 0x7FFF;
+    if(u32Key < IM_ARRAYSIZE(_rstIO.KeysDown))
+    {
+      _rstIO.KeysDown[u32Key] = (au16Keys[i] & 0x8000) ? true : false;
+    }
+  }
+
+  return sstImGuiLog.acReplayText;
+}
+
+static orxSTATUS orxFASTCALL orxImGui_EventHandler(const orxEVENT *_pstEvent)
+{
+  // Video mode changes are the only thing that moves the screen and framebuffer sizes
+  sstImGuiInput.bDisplayDirty = orxTRUE;
+  return orxSTATUS_SUCCESS;
+}
+
 static orxSTATUS orxFASTCALL orxImGui_BeginFrame(const orxEVENT *_pstEvent)
 {
+  orxPROFILER_PUSH_MARKER("orxImGui_BeginFrame");
+  orxDOUBLE dStartTime = (sstImGui.pfnTrace != orxNULL) ? orxSystem_GetTime() : orxDOUBLE_0;
+
   if(sbImGuiInFrame)
   {
     ImGui::EndFrame();
@@ -67,66 +727,139 @@ static orxSTATUS orxFASTCALL orxImGui_BeginFrame(const orxEVENT *_pstEvent)
 
   sbImGuiInFrame = orxTRUE;
 
+  sstImGui.u32LastFrameAllocationCount  = sstImGui.u32FrameAllocationCount;
+  sstImGui.u32LastFrameAllocationSize   = sstImGui.u32FrameAllocationSize;
+  sstImGui.u32FrameAllocationCount      = 0;
+  sstImGui.u32FrameAllocationSize       = 0;
+  sstImGui.dLastFrameAllocatorTime      = sstImGui.dFrameAllocatorTime;
+  sstImGui.dFrameAllocatorTime          = orxDOUBLE_0;
+
+  orxImGui_ResetArena();
+
   ImGuiIO &rstIO = ImGui::GetIO();
 
+  // Dear ImGui needs time to pass: frames can begin before the core clock's first tick,
+  // as in animtester_bench, or while it's paused
   rstIO.DeltaTime = orxClock_GetInfo(orxClock_Get(orxCLOCK_KZ_CORE))->fDT;
+  if(rstIO.DeltaTime <= orxFLOAT_0)
+  {
+    rstIO.DeltaTime = orxIMGUI_KF_DEFAULT_DT;
+  }
 
-  orxDisplay_GetScreenSize(&rstIO.DisplaySize.x, &rstIO.DisplaySize.y);
-  orxVECTOR vFramebufferSize;
-  orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
-  orxConfig_GetVector(orxDISPLAY_KZ_CONFIG_FRAMEBUFFER_SIZE, &vFramebufferSize);
-  orxConfig_PopSection();
-  rstIO.DisplayFramebufferScale.x = vFramebufferSize.fX / rstIO.DisplaySize.x;
-  rstIO.DisplayFramebufferScale.y = vFramebufferSize.fY / rstIO.DisplaySize.y;
+  if(sstImGuiInput.bDisplayDirty)
+  {
+    orxImGui_UpdateDisplay();
+  }
+  rstIO.DisplaySize             = sstImGuiInput.vDisplaySize;
+  rstIO.DisplayFramebufferScale = sstImGuiInput.vFramebufferScale;
+
+  orxBOOL bChanged = orxFALSE;
 
   orxVECTOR vMousePos;
-  orxMouse_GetPosition(&vMousePos);
-  rstIO.MousePos.x = vMousePos.fX;
-  rstIO.MousePos.y = vMousePos.fY;
-  rstIO.MouseWheel = orxMouse_GetWheelDelta();
-  for(int i = 0; i < IM_ARRAYSIZE(rstIO.MouseDown); i++)
+  const orxSTRING zReplayText = (sstImGuiLog.pstReplayFile != orxNULL) ? orxImGui_ReplayFrame(rstIO) : orxNULL;
+  if(zReplayText != orxNULL)
   {
-    rstIO.MouseDown[i] = orxMouse_IsButtonPressed((orxMOUSE_BUTTON)i) ? true : false;
+    // Replayed frames always count as input, so the app never idles during a replay
+    bChanged = orxTRUE;
   }
-
-  for(unsigned int i = 0; i < orxKEYBOARD_KEY_NUMBER; i++)
+  else
   {
-    rstIO.KeysDown[i] = orxKeyboard_IsKeyPressed((orxKEYBOARD_KEY)i) ? true : false;
+    orxMouse_GetPosition(&vMousePos);
+    if((vMousePos.fX != rstIO.MousePos.x) || (vMousePos.fY != rstIO.MousePos.y))
+    {
+      rstIO.MousePos.x = vMousePos.fX;
+      rstIO.MousePos.y = vMousePos.fY;
+      bChanged = orxTRUE;
+    }
+    rstIO.MouseWheel = orxMouse_GetWheelDelta();
+    bChanged |= (rstIO.MouseWheel != 0.0f);
+    for(int i = 0; i < IM_ARRAYSIZE(rstIO.MouseDown); i++)
+    {
+      bool bDown = orxMouse_IsButtonPressed((orxMOUSE_BUTTON)i) ? true : false;
+      if(bDown != rstIO.MouseDown[i])
+      {
+        rstIO.MouseDown[i] = bDown;
+        bChanged = orxTRUE;
+      }
+    }
+
+    // Only the keys ImGui maps and the modifiers are ever read, leave the rest of KeysDown alone
+    for(orxU32 i = 0; i < sstImGuiInput.u32KeyCount; i++)
+    {
+      orxKEYBOARD_KEY eKey = sstImGuiInput.aeKeyList[i];
+      bool bDown = orxKeyboard_IsKeyPressed(eKey) ? true : false;
+      if(bDown != rstIO.KeysDown[eKey])
+      {
+        rstIO.KeysDown[eKey] = bDown;
+        bChanged = orxTRUE;
+      }
+    }
   }
-  rstIO.KeyCtrl   = (orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_LCTRL) || orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_RCTRL)) ? true : false;
-  rstIO.KeyShift  = (orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_LSHIFT) || orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_RSHIFT)) ? true : false;
-  rstIO.KeyAlt    = (orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_LALT) || orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_RALT)) ? true : false;
-  rstIO.KeySuper  = (orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_LSYSTEM) || orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_RSYSTEM)) ? true : false;
+  rstIO.KeyCtrl   = rstIO.KeysDown[orxKEYBOARD_KEY_LCTRL] || rstIO.KeysDown[orxKEYBOARD_KEY_RCTRL];
+  rstIO.KeyShift  = rstIO.KeysDown[orxKEYBOARD_KEY_LSHIFT] || rstIO.KeysDown[orxKEYBOARD_KEY_RSHIFT];
+  rstIO.KeyAlt    = rstIO.KeysDown[orxKEYBOARD_KEY_LALT] || rstIO.KeysDown[orxKEYBOARD_KEY_RALT];
+  rstIO.KeySuper  = rstIO.KeysDown[orxKEYBOARD_KEY_LSYSTEM] || rstIO.KeysDown[orxKEYBOARD_KEY_RSYSTEM];
 
-  rstIO.NavInputs[ImGuiNavInput_Activate]     = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_A_1) ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_Cancel]       = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_B_1) ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_Input]        = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_Y_1) ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_Menu]         = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_X_1) ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_DpadLeft]     = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_LEFT_1) ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_DpadRight]    = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_RIGHT_1) ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_DpadUp]       = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_UP_1) ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_DpadDown]     = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_DOWN_1) ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_LStickLeft]   = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_LX_1) <= -0.3f ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_LStickRight]  = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_LX_1) >= 0.3f ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_LStickUp]     = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_LY_1) <= -0.3f ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_LStickDown]   = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_LY_1) >= 0.3f ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_FocusPrev]    = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_LBUMPER_1) ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_FocusNext]    = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_RBUMPER_1) ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_TweakSlow]    = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_LTRIGGER_1) >= 0.3f ? 1.0f : 0.0f;
-  rstIO.NavInputs[ImGuiNavInput_TweakFast]    = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_RTRIGGER_1) >= 0.3f ? 1.0f : 0.0f;
+  // NavInputs are cleared by ImGui::EndFrame(), so they're re-sent from our copy while a pad is connected
+  if((zReplayText == orxNULL) && orxJoystick_IsConnected(1))
+  {
+    float afNavInputs[ImGuiNavInput_COUNT] = {};
+    afNavInputs[ImGuiNavInput_Activate]     = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_A_1) ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_Cancel]       = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_B_1) ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_Input]        = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_Y_1) ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_Menu]         = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_X_1) ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_DpadLeft]     = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_LEFT_1) ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_DpadRight]    = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_RIGHT_1) ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_DpadUp]       = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_UP_1) ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_DpadDown]     = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_DOWN_1) ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_LStickLeft]   = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_LX_1) <= -0.3f ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_LStickRight]  = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_LX_1) >= 0.3f ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_LStickUp]     = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_LY_1) <= -0.3f ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_LStickDown]   = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_LY_1) >= 0.3f ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_FocusPrev]    = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_LBUMPER_1) ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_FocusNext]    = orxJoystick_IsButtonPressed(orxJOYSTICK_BUTTON_RBUMPER_1) ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_TweakSlow]    = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_LTRIGGER_1) >= 0.3f ? 1.0f : 0.0f;
+    afNavInputs[ImGuiNavInput_TweakFast]    = orxJoystick_GetAxisValue(orxJOYSTICK_AXIS_RTRIGGER_1) >= 0.3f ? 1.0f : 0.0f;
+    if(orxMemory_Compare(afNavInputs, sstImGuiInput.afNavInputs, sizeof(afNavInputs)) != 0)
+    {
+      orxMemory_Copy(sstImGuiInput.afNavInputs, afNavInputs, sizeof(afNavInputs));
+      bChanged = orxTRUE;
+    }
+    orxMemory_Copy(rstIO.NavInputs, sstImGuiInput.afNavInputs, sizeof(rstIO.NavInputs));
+    sstImGuiInput.bJoystickConnected = orxTRUE;
+  }
+  else if(sstImGuiInput.bJoystickConnected)
+  {
+    orxMemory_Zero(sstImGuiInput.afNavInputs, sizeof(sstImGuiInput.afNavInputs));
+    sstImGuiInput.bJoystickConnected = orxFALSE;
+    bChanged = orxTRUE;
+  }
 
   ImGui::NewFrame();
 
+  const orxSTRING zInput = (zReplayText != orxNULL) ? zReplayText : orxSTRING_EMPTY;
   if(rstIO.WantTextInput)
   {
     orxKeyboard_Show(orxTRUE);
-    rstIO.AddInputCharactersUTF8(orxKeyboard_ReadString());
+    if(zReplayText == orxNULL)
+    {
+      zInput = orxKeyboard_ReadString();
+    }
   }
   else
   {
     orxKeyboard_Show(orxFALSE);
   }
-  if(rstIO.WantSetMousePos)
+  if(*zInput != orxCHAR_NULL)
+  {
+    rstIO.AddInputCharactersUTF8(zInput);
+    bChanged = orxTRUE;
+  }
+  if(sstImGuiLog.pstRecordFile != orxNULL)
+  {
+    orxImGui_RecordFrame(rstIO, zInput);
+  }
+  if(rstIO.WantSetMousePos && (zReplayText == orxNULL))
   {
     orxMouse_SetPosition(orxVector_Set(&vMousePos, rstIO.MousePos.x, rstIO.MousePos.y, orxFLOAT_0));
   }
@@ -147,11 +880,23 @@ static orxSTATUS orxFASTCALL orxImGui_BeginFrame(const orxEVENT *_pstEvent)
     orxInput_SetTypeFlags(orxINPUT_GET_FLAG(orxINPUT_TYPE_KEYBOARD_KEY), orxINPUT_KU32_FLAG_TYPE_NONE);
   }
 
+  sstImGui.bInputChanged = bChanged;
+
+  if(sstImGui.pfnTrace != orxNULL)
+  {
+    sstImGui.pfnTrace("orxImGui_BeginFrame", dStartTime, orxSystem_GetTime());
+  }
+
+  orxPROFILER_POP_MARKER();
+
   return orxSTATUS_SUCCESS;
 }
 
 static orxSTATUS orxFASTCALL orxImGui_EndFrame(const orxEVENT *_pstEvent)
 {
+  orxPROFILER_PUSH_MARKER("orxImGui_EndFrame");
+  orxDOUBLE dStartTime = (sstImGui.pfnTrace != orxNULL) ? orxSystem_GetTime() : orxDOUBLE_0;
+
   if(sbImGuiInFrame)
   {
     sbImGuiInFrame = orxFALSE;
@@ -163,8 +908,15 @@ static orxSTATUS orxFASTCALL orxImGui_EndFrame(const orxEVENT *_pstEvent)
     orxBITMAP *pstScreen = orxDisplay_GetScreenBitmap();
     orxDisplay_SetDestinationBitmaps(&pstScreen, 1);
 
-    orxDISPLAY_MESH stMesh = {};
-    stMesh.ePrimitive = orxDISPLAY_PRIMITIVE_TRIANGLES;
+    sstImGui.u32CommandCount          = 0;
+    sstImGui.u32DrawCallCount         = 0;
+    sstImGui.u32CulledTriangleCount   = 0;
+
+    sstImGuiBatch.pstScreen           = pstScreen;
+    sstImGuiBatch.vDisplayPos         = pstDrawData->DisplayPos;
+
+    orxPROFILER_PUSH_MARKER("orxImGui_Draw");
+    orxDOUBLE dDrawStartTime = (sstImGui.pfnTrace != orxNULL) ? orxSystem_GetTime() : orxDOUBLE_0;
 
     for(int i = 0; i < pstDrawData->CmdListsCount; i++)
     {
@@ -176,24 +928,45 @@ static orxSTATUS orxFASTCALL orxImGui_EndFrame(const orxEVENT *_pstEvent)
 
         if(rstCommand.UserCallback)
         {
-          rstCommand.UserCallback(pstDrawList, &rstCommand);
+          // Callbacks may change render state so everything queued so far is sent first
+          orxImGui_FlushBatch();
+          if(rstCommand.UserCallback != ImDrawCallback_ResetRenderState)
+          {
+            rstCommand.UserCallback(pstDrawList, &rstCommand);
+          }
         }
         else
         {
-          stMesh.astVertexList    = (orxDISPLAY_VERTEX *)(pstDrawList->VtxBuffer.Data + rstCommand.VtxOffset);
-          stMesh.u32VertexNumber  = pstDrawList->VtxBuffer.Size - rstCommand.VtxOffset;
-          stMesh.au16IndexList    = pstDrawList->IdxBuffer.Data + rstCommand.IdxOffset;
-          stMesh.u32IndexNumber   = rstCommand.ElemCount;
-          // Smoothing is off everywhere so that textures in GUI widgets have no smoothing applied
-          orxDisplay_DrawMesh(&stMesh, (orxBITMAP *)rstCommand.TextureId, orxDISPLAY_SMOOTHING_OFF, orxDISPLAY_BLEND_MODE_ALPHA);
+          orxImGui_AddCommand(pstDrawList, rstCommand);
+          sstImGui.u32CommandCount++;
         }
-        stMesh.au16IndexList += rstCommand.ElemCount;
       }
     }
+    orxImGui_FlushBatch();
+
+    if(sstImGui.pfnTrace != orxNULL)
+    {
+      sstImGui.pfnTrace("orxImGui_Draw", dDrawStartTime, orxSystem_GetTime());
+    }
+
+    orxPROFILER_POP_MARKER();
+
+    // Restore full screen clipping
+    orxFLOAT fScreenWidth, fScreenHeight;
+    orxDisplay_GetBitmapSize(pstScreen, &fScreenWidth, &fScreenHeight);
+    orxDisplay_SetBitmapClipping(pstScreen, 0, 0, (orxU32)fScreenWidth, (orxU32)fScreenHeight);
+
     orxInput_SetTypeFlags(orxINPUT_GET_FLAG(orxINPUT_TYPE_MOUSE_BUTTON) | orxINPUT_GET_FLAG(orxINPUT_TYPE_MOUSE_AXIS), orxINPUT_KU32_FLAG_TYPE_NONE);
     orxInput_SetTypeFlags(orxINPUT_GET_FLAG(orxINPUT_TYPE_KEYBOARD_KEY), orxINPUT_KU32_FLAG_TYPE_NONE);
   }
 
+  if(sstImGui.pfnTrace != orxNULL)
+  {
+    sstImGui.pfnTrace("orxImGui_EndFrame", dStartTime, orxSystem_GetTime());
+  }
+
+  orxPROFILER_POP_MARKER();
+
   return orxSTATUS_SUCCESS;
 }
 
@@ -202,6 +975,14 @@ orxSTATUS orxFASTCALL orxImGui_Init()
   sbImGuiInFrame = orxFALSE;
 
   orxMemory_Zero(&sstImGui, sizeof(orxIMGUI));
+  orxMemory_Zero(&sstImGuiAllocator, sizeof(orxIMGUI_ALLOCATOR_STATE));
+  orxMemory_Zero(&sstImGuiInput, sizeof(orxIMGUI_INPUT));
+
+  orxConfig_PushSection(orxIMGUI_KZ_CONFIG_SECTION);
+  sstImGui.eAllocator = (orxString_ICompare(orxConfig_GetString(orxIMGUI_KZ_CONFIG_ALLOCATOR), orxIMGUI_KZ_ALLOCATOR_SYSTEM) == 0) ? orxIMGUI_ALLOCATOR_SYSTEM : orxIMGUI_ALLOCATOR_TIERED;
+  orxConfig_PopSection();
+
+  orxMemory_Zero(&sstImGuiLog, sizeof(orxIMGUI_LOG));
 
   ImGui::SetAllocatorFunctions(&orxImGui_Allocate, &orxImGui_Free);
   ImGui::CreateContext();
@@ -231,6 +1012,20 @@ orxSTATUS orxFASTCALL orxImGui_Init()
   rstIO.KeyMap[ImGuiKey_Y]          = orxKEYBOARD_KEY_Y;
   rstIO.KeyMap[ImGuiKey_Z]          = orxKEYBOARD_KEY_Z;
 
+  for(int i = 0; i < ImGuiKey_COUNT; i++)
+  {
+    orxImGui_AddKey((orxKEYBOARD_KEY)rstIO.KeyMap[i]);
+  }
+  orxImGui_AddKey(orxKEYBOARD_KEY_LCTRL);
+  orxImGui_AddKey(orxKEYBOARD_KEY_RCTRL);
+  orxImGui_AddKey(orxKEYBOARD_KEY_LSHIFT);
+  orxImGui_AddKey(orxKEYBOARD_KEY_RSHIFT);
+  orxImGui_AddKey(orxKEYBOARD_KEY_LALT);
+  orxImGui_AddKey(orxKEYBOARD_KEY_RALT);
+  orxImGui_AddKey(orxKEYBOARD_KEY_LSYSTEM);
+  orxImGui_AddKey(orxKEYBOARD_KEY_RSYSTEM);
+  orxImGui_UpdateDisplay();
+
   orxConfig_PushSection(orxIMGUI_KZ_CONFIG_SECTION);
 
   sstImGui.pstDefaultFont = rstIO.Fonts->AddFontDefault();
@@ -298,6 +1093,28 @@ orxSTATUS orxFASTCALL orxImGui_Init()
   orxEvent_SetHandlerIDFlags(&orxImGui_BeginFrame, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_GET_FLAG(orxRENDER_EVENT_STOP), orxEVENT_KU32_MASK_ID_ALL);
   orxEvent_AddHandler(orxEVENT_TYPE_RENDER, &orxImGui_EndFrame);
   orxEvent_SetHandlerIDFlags(&orxImGui_EndFrame, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_GET_FLAG(orxRENDER_EVENT_PROFILER_START), orxEVENT_KU32_MASK_ID_ALL);
+  orxEvent_AddHandler(orxEVENT_TYPE_DISPLAY, &orxImGui_EventHandler);
+  orxEvent_SetHandlerIDFlags(&orxImGui_EventHandler, orxEVENT_TYPE_DISPLAY, orxNULL, orxEVENT_GET_FLAG(orxDISPLAY_EVENT_SET_VIDEO_MODE), orxEVENT_KU32_MASK_ID_ALL);
+
+  orxConfig_PushSection(orxIMGUI_KZ_CONFIG_SECTION);
+  const orxSTRING zReplay = orxConfig_GetString(orxIMGUI_KZ_CONFIG_REPLAY);
+  const orxSTRING zRecord = orxConfig_GetString(orxIMGUI_KZ_CONFIG_RECORD);
+  if(*zReplay != orxCHAR_NULL)
+  {
+    sstImGuiLog.bQuitAfterReplay = orxConfig_GetBool(orxIMGUI_KZ_CONFIG_QUIT_AFTER_REPLAY);
+    if(orxImGui_StartReplay(zReplay, orxConfig_GetFloat(orxIMGUI_KZ_CONFIG_REPLAY_DELTA_TIME)) == orxSTATUS_FAILURE)
+    {
+      orxLOG("Can't replay ImGui input from <%s>", zReplay);
+    }
+  }
+  else if(*zRecord != orxCHAR_NULL)
+  {
+    if(orxImGui_StartRecording(zRecord) == orxSTATUS_FAILURE)
+    {
+      orxLOG("Can't record ImGui input to <%s>", zRecord);
+    }
+  }
+  orxConfig_PopSection();
 
   orxImGui_BeginFrame(orxNULL);
 
@@ -308,9 +1125,15 @@ void orxFASTCALL orxImGui_Exit()
 {
   orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, &orxImGui_BeginFrame);
   orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, &orxImGui_EndFrame);
+  orxEvent_RemoveHandler(orxEVENT_TYPE_DISPLAY, &orxImGui_EventHandler);
   orxImGui_EndFrame(orxNULL);
+  orxImGui_StopRecording();
+  orxImGui_StopReplay();
   orxDisplay_DeleteBitmap((orxBITMAP *)ImGui::GetIO().Fonts->TexID);
+  sstImGuiBatch.astVertexList.clear();
+  sstImGuiBatch.au16IndexList.clear();
   ImGui::DestroyContext();
+  orxImGui_ExitAllocator();
   if(sstImGui.apstFonts != orxNULL)
   {
     orxMemory_Free(sstImGui.apstFonts);
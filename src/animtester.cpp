@@ -4,16 +4,39 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <map>
 #include <optional>
 #include <set>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include "orx.h"
 
+// SSE2 is always there on x64, and enabled by the build on x86
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define __animtesterSSE2__
+#include <emmintrin.h>
+#endif
+
 #define orxIMGUI_IMPL
 #include "orxImGui.h"
 #undef orxIMGUI_IMPL
 
+// Atlas packing, static so it doesn't clash with ImGui's own copy
+#define STBRP_STATIC
+#define STBRP_ASSERT(x) orxASSERT(x)
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "imstb_rectpack.h"
+
 #ifdef __orxMSVC__
 
 /* Requesting high performance dedicated GPU on hybrid laptops */
@@ -22,11 +45,245 @@ __declspec(dllexport) int AmdPowerXpressRequestHighPerformance = 1;
 
 #endif // __orxMSVC__
 
+namespace memory
+{
+    // Only allocations made by the main thread are counted
+    thread_local bool track = false;
+
+    orxU32 frameAllocationCount = 0;
+    orxU32 frameAllocationSize = 0;
+    orxU32 lastFrameAllocationCount = 0;
+    orxU32 lastFrameAllocationSize = 0;
+
+    // Whether the last frame had no input, edit or save, so neither the UI
+    // nor the app code should have allocated anything
+    orxBOOL lastFrameSteady = orxFALSE;
+    orxU32 steadyFrameCount = 0;
+
+    orxBOOL showOverlay = orxFALSE;
+    orxBOOL assertSteady = orxFALSE;
+
+    void *Allocate(std::size_t size)
+    {
+        if (track)
+        {
+            frameAllocationCount++;
+            frameAllocationSize += size;
+        }
+        auto ptr = std::malloc(size > 0 ? size : 1);
+        if (ptr == nullptr)
+            std::abort();
+        return ptr;
+    }
+}
+
+void *operator new(std::size_t size) { return memory::Allocate(size); }
+void *operator new[](std::size_t size) { return memory::Allocate(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+
 const orxSTRING objectName = "Character";
 orxOBJECT *targetObject = orxNULL;
-orxBOOL configChanged = orxFALSE;
 std::optional<std::string> save = std::nullopt;
 
+// Defined below with the other orx callbacks, also used by command-line modes
+orxSTATUS orxFASTCALL Bootstrap();
+
+namespace trace
+{
+    // Scope timings streamed to a Chrome trace event file, which can be
+    // opened in chrome://tracing or Perfetto. Each thread records into its
+    // own ring and a background thread writes them out, so recording never
+    // blocks or touches the file.
+    struct Event
+    {
+        const orxCHAR *name;
+        orxDOUBLE start;
+        orxDOUBLE end;
+    };
+
+    const size_t ringSize = 4096; // Must be a power of two
+    const orxU32 maxThreads = 16;
+
+    // Single producer (the owning thread), single consumer (the flusher)
+    struct Ring
+    {
+        Event events[ringSize];
+        std::atomic<size_t> head{0};
+        std::atomic<size_t> tail{0};
+        std::atomic<orxU32> dropped{0};
+        orxU32 threadID = 0;
+    };
+
+    std::atomic<Ring *> rings[maxThreads]{};
+    std::atomic<orxU32> ringCount{0};
+    thread_local Ring *threadRing = nullptr;
+    thread_local bool noRing = false;
+
+    std::atomic<bool> enabled{false};
+    std::FILE *file = nullptr;
+    orxU32 flusher = orxU32_UNDEFINED;
+    orxDOUBLE startTime = orxDOUBLE_0;
+    orxU32 eventCount = 0;
+
+    Ring *GetRing()
+    {
+        if (threadRing == nullptr && !noRing)
+        {
+            auto index = ringCount++;
+            if (index < maxThreads)
+            {
+                threadRing = new Ring{};
+                threadRing->threadID = orxThread_GetCurrent();
+                rings[index].store(threadRing, std::memory_order_release);
+            }
+            else
+            {
+                noRing = true;
+            }
+        }
+        return threadRing;
+    }
+
+    void Record(const orxCHAR *name, orxDOUBLE start, orxDOUBLE end)
+    {
+        // Scopes still open when tracing stops don't bring rings back
+        if (!enabled)
+            return;
+        auto ring = GetRing();
+        if (ring == nullptr)
+            return;
+        auto head = ring->head.load(std::memory_order_relaxed);
+        if (head - ring->tail.load(std::memory_order_acquire) >= ringSize)
+        {
+            // Never wait on the flusher, losing events beats skewing timings
+            ring->dropped++;
+            return;
+        }
+        ring->events[head & (ringSize - 1)] = {name, start, end};
+        ring->head.store(head + 1, std::memory_order_release);
+    }
+
+    void orxFASTCALL RecordImGui(const orxSTRING name, orxDOUBLE start, orxDOUBLE end)
+    {
+        Record(name, start, end);
+    }
+
+    // Records the enclosing scope, name must outlive the trace
+    struct Scope
+    {
+        const orxCHAR *name;
+        orxDOUBLE start;
+
+        Scope(const orxCHAR *name) : name(name), start(enabled ? orxSystem_GetTime() : orxDOUBLE_0) {}
+        ~Scope()
+        {
+            if (start > orxDOUBLE_0)
+                Record(name, start, orxSystem_GetTime());
+        }
+    };
+
+    // Profiler marker and trace scope of the enclosing block, pushed by
+    // PROFILE_SCOPE and popped on every way out of the block
+    struct ProfileScope
+    {
+        Scope scope;
+
+        ProfileScope(const orxCHAR *name) : scope(name) {}
+        ~ProfileScope()
+        {
+            orxPROFILER_POP_MARKER();
+        }
+    };
+
+    // Write out everything recorded so far, only called by one thread at a time
+    void Drain()
+    {
+        for (orxU32 i = 0, count = orxMIN(ringCount.load(), maxThreads); i < count; i++)
+        {
+            auto ring = rings[i].load(std::memory_order_acquire);
+            if (ring == nullptr)
+                continue;
+            auto tail = ring->tail.load(std::memory_order_relaxed);
+            auto head = ring->head.load(std::memory_order_acquire);
+            for (; tail != head; tail++)
+            {
+                const auto &event = ring->events[tail & (ringSize - 1)];
+                std::fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                             eventCount++ > 0 ? "," : "", event.name, (event.start - startTime) * 1e6, (event.end - event.start) * 1e6, ring->threadID);
+            }
+            ring->tail.store(tail, std::memory_order_release);
+        }
+    }
+
+    orxSTATUS orxFASTCALL Flush(void *_pContext)
+    {
+        Drain();
+        orxSystem_Delay(0.05f);
+        return orxSTATUS_SUCCESS;
+    }
+
+    void Init()
+    {
+        orxConfig_PushSection("AnimTester");
+        auto path = orxConfig_GetString("TraceFile");
+        orxConfig_PopSection();
+        if (*path == orxCHAR_NULL)
+            return;
+
+        file = std::fopen(path, "wb");
+        if (file == nullptr)
+        {
+            orxLOG("Can't open trace file %s", path);
+            return;
+        }
+        std::fputs("{\"traceEvents\":[", file);
+        startTime = orxSystem_GetTime();
+
+        // Main thread ring up front, so it isn't allocated in a steady frame
+        GetRing();
+        flusher = orxThread_Start(Flush, "Trace", orxNULL);
+        enabled = true;
+        sstImGui.pfnTrace = RecordImGui;
+    }
+
+    void Exit()
+    {
+        if (file == nullptr)
+            return;
+        enabled = false;
+        sstImGui.pfnTrace = orxNULL;
+        if (flusher != orxU32_UNDEFINED)
+            orxThread_Join(flusher);
+
+        // The flusher is gone, pick up what it didn't get to
+        Drain();
+        std::fputs("\n]}\n", file);
+        std::fclose(file);
+        file = nullptr;
+
+        orxU32 dropped = 0;
+        for (orxU32 i = 0, count = orxMIN(ringCount.load(), maxThreads); i < count; i++)
+        {
+            if (auto ring = rings[i].load())
+                dropped += ring->dropped;
+        }
+        if (dropped > 0)
+            orxLOG("Trace: %u events dropped, rings were full", dropped);
+
+        // Rings stay allocated until the process exits: a worker past the
+        // enabled check in Record may still be writing into its own, and
+        // every thread keeps pointing at its ring
+    }
+}
+
+// The marker ID is cached per call site by orx, so the push stays in the macro
+#define PROFILE_SCOPE(NAME) \
+    orxPROFILER_PUSH_MARKER(NAME); \
+    trace::ProfileScope profileScope { NAME }
+
 namespace animset
 {
     std::vector<orxANIM *> GetAnims(const orxANIMSET *animSet, bool sorted = true)
@@ -41,9 +298,127 @@ namespace animset
         }
         if (sorted)
             std::sort(animations.begin(), animations.end(), [](auto a, auto b)
-                      { return std::string{orxAnim_GetName(a)} < std::string{orxAnim_GetName(b)}; });
+                      { return orxString_Compare(orxAnim_GetName(a), orxAnim_GetName(b)) < 0; });
         return animations;
     }
+
+    // Sorted view of an animation set's animations, built once per set,
+    // with their section and link key names interned
+    struct Index
+    {
+        std::vector<orxANIM *> anims{};
+        std::vector<orxU32> ids{};
+        std::vector<const orxCHAR *> names{};
+        std::vector<const orxCHAR *> sectionNames{};
+        std::vector<const orxCHAR *> linkSources{};
+        std::vector<orxU32> frameCounts{};
+        // Position in the sorted view, by animation ID
+        std::vector<size_t> positions{};
+    };
+
+    // Indices keyed by animation set GUID, so a re-created set never picks
+    // up a stale index from a previous set at the same address
+    std::map<orxU64, Index> indices{};
+
+    // Built on first use, see below; needs the config helpers
+    const Index &GetIndex(const orxANIMSET *animSet);
+
+    // Link properties preserved when an animation is swapped out of a set
+    const orxU32 linkProperties[] = {
+        orxANIMSET_KU32_LINK_FLAG_LOOP_COUNT,
+        orxANIMSET_KU32_LINK_FLAG_PRIORITY,
+        orxANIMSET_KU32_LINK_FLAG_IMMEDIATE_CYCLE,
+        orxANIMSET_KU32_LINK_FLAG_CLEAR_TARGET};
+
+    struct Link
+    {
+        orxU32 src;
+        orxU32 dst;
+        orxU32 properties[orxARRAY_GET_ITEM_COUNT(linkProperties)];
+    };
+
+    // Create a single animation from config, using a temporary animation set
+    // which inherits everything from the live set but only starts (and
+    // stops) at the requested animation.
+    orxANIM *CreateAnimFromConfig(const orxSTRING animSetName, const orxSTRING animSectionName, const orxSTRING animName)
+    {
+        const orxSTRING scratchName = "AnimTesterHotSwapSet";
+
+        // The animation section may get re-parented while the temporary set
+        // is created so restore its original parent afterwards
+        auto animParent = orxConfig_GetParent(animSectionName);
+
+        orxConfig_SetParent(scratchName, animSetName);
+        orxConfig_PushSection(scratchName);
+        orxConfig_SetListString("StartAnimList", &animName, 1);
+        std::string src{animName};
+        src += "->";
+        orxConfig_SetString(src.c_str(), orxSTRING_EMPTY);
+        orxConfig_PopSection();
+
+        orxANIM *anim = orxNULL;
+        auto scratch = orxAnimSet_CreateFromConfig(scratchName);
+        if (scratch != orxNULL)
+        {
+            if (orxAnimSet_GetAnimCount(scratch) == 1)
+            {
+                anim = orxAnimSet_GetAnim(scratch, 0);
+                orxStructure_IncreaseCount(anim);
+            }
+            orxAnimSet_Delete(scratch);
+        }
+
+        orxConfig_ClearSection(scratchName);
+        orxConfig_SetParent(animSectionName, animParent);
+
+        return anim;
+    }
+
+    // Swap the animation at animID with anim, keeping the ID and every link
+    // to or from that animation. Returns orxFALSE if the set was left
+    // unchanged or could not be restored, in which case it must be rebuilt.
+    orxBOOL ReplaceAnim(orxANIMSET *animSet, orxU32 animID, orxANIM *anim)
+    {
+        // Collect links touching the animation along with their properties
+        std::vector<Link> links{};
+        auto collect = [&](orxU32 src, orxU32 dst)
+        {
+            auto linkID = orxAnimSet_GetLink(animSet, src, dst);
+            if (linkID == orxU32_UNDEFINED)
+                return;
+            Link link{src, dst, {}};
+            for (size_t i = 0; i < orxARRAY_GET_ITEM_COUNT(linkProperties); i++)
+                link.properties[i] = orxAnimSet_GetLinkProperty(animSet, linkID, linkProperties[i]);
+            links.push_back(link);
+        };
+        auto animationCount = orxAnimSet_GetAnimCount(animSet);
+        for (orxU32 other = 0; other < animationCount; other++)
+        {
+            // Outgoing then incoming links, a self link is only recorded once
+            collect(animID, other);
+            if (other != animID)
+                collect(other, animID);
+        }
+
+        if (orxAnimSet_RemoveAnim(animSet, animID) == orxSTATUS_FAILURE)
+            return orxFALSE;
+
+        // The freed slot is the first empty one so the new animation takes
+        // over the old ID
+        if (orxAnimSet_AddAnim(animSet, anim) != animID)
+            return orxFALSE;
+
+        for (const auto &link : links)
+        {
+            auto linkID = orxAnimSet_AddLink(animSet, link.src, link.dst);
+            if (linkID == orxU32_UNDEFINED)
+                return orxFALSE;
+            for (size_t i = 0; i < orxARRAY_GET_ITEM_COUNT(linkProperties); i++)
+                orxAnimSet_SetLinkProperty(animSet, linkID, linkProperties[i], link.properties[i]);
+        }
+
+        return orxTRUE;
+    }
 }
 
 namespace object
@@ -69,10 +444,283 @@ namespace object
         auto animSet = GetAnimSet(object);
         return animset::GetAnims(animSet);
     }
+
+    // Whether the object's displayed frame can still change on its own
+    orxBOOL IsAnimating(orxOBJECT *object)
+    {
+        auto animPointer = orxOBJECT_GET_STRUCTURE(object, ANIMPOINTER);
+        if (animPointer == orxNULL || orxAnimPointer_IsPaused(animPointer) || orxAnimPointer_GetFrequency(animPointer) <= orxFLOAT_0)
+            return orxFALSE;
+
+        auto current = orxAnimPointer_GetCurrentAnim(animPointer);
+        if (current == orxANIMPOINTER_KU32_ANIM_ID_NONE)
+            return orxFALSE;
+
+        // A single key animation only changes when it links to another one
+        auto anim = orxAnimSet_GetAnim(orxAnimPointer_GetAnimSet(animPointer), current);
+        return orxAnim_GetKeyCount(anim) > 1 || orxAnimPointer_GetTargetAnim(animPointer) != current;
+    }
+}
+
+namespace saver
+{
+    // Modification time and size of a file, to notice it changed
+    struct Stamp
+    {
+        std::filesystem::file_time_type time{};
+        std::uintmax_t size = 0;
+
+        bool operator==(const Stamp &other) const
+        {
+            return time == other.time && size == other.size;
+        }
+        bool operator!=(const Stamp &other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    Stamp GetStamp(const std::string &file)
+    {
+        Stamp stamp{};
+        std::error_code error;
+        stamp.time = std::filesystem::last_write_time(file, error);
+        if (!error)
+            stamp.size = std::filesystem::file_size(file, error);
+        return stamp;
+    }
+
+    // Snapshot of config text to be written to a file by a worker thread.
+    // The content was patched over the file as of base, written is the
+    // file once the write landed.
+    struct Task
+    {
+        std::string file;
+        std::string content;
+        orxDOUBLE requestTime;
+        Stamp base;
+        Stamp written;
+        orxSTATUS status;
+        bool changed;
+        std::atomic<bool> finished;
+    };
+
+    // Save state for a single origin file. At most one write per file is in
+    // flight, newer requests replace the pending one.
+    struct Job
+    {
+        std::optional<std::string> pending = std::nullopt;
+        orxDOUBLE pendingTime = orxDOUBLE_0;
+        orxBOOL inFlight = orxFALSE;
+        Task *task = nullptr;
+        orxSTATUS lastStatus = orxSTATUS_SUCCESS;
+        orxDOUBLE lastLatency = orxDOUBLE_0;
+        orxU32 saveCount = 0;
+        orxU32 coalescedCount = 0;
+        // The file as of our last write, so it isn't taken for a hand edit
+        Stamp stamp{};
+    };
+
+    // Transparent comparison so lookups by orxSTRING don't allocate
+    std::map<std::string, Job, std::less<>> jobs{};
+
+    // Write to a temporary file next to the target then rename it over the
+    // target, so a crash never leaves a half-written config file behind.
+    // Fails, with changed set, rather than overwrite edits made by hand
+    // since base; stamp is the file once written.
+    orxSTATUS Write(const std::string &file, const std::string &content, const Stamp &base, Stamp &stamp, bool &changed)
+    {
+        changed = false;
+        auto tmp = file + ".tmp";
+        auto handle = std::fopen(tmp.data(), "wb");
+        if (handle == nullptr)
+            return orxSTATUS_FAILURE;
+        auto written = std::fwrite(content.data(), 1, content.size(), handle);
+        auto closed = std::fclose(handle);
+        if (written != content.size() || closed != 0)
+        {
+            std::remove(tmp.data());
+            return orxSTATUS_FAILURE;
+        }
+
+        if (GetStamp(file) != base)
+        {
+            std::remove(tmp.data());
+            changed = true;
+            return orxSTATUS_FAILURE;
+        }
+        std::error_code error;
+        std::filesystem::rename(tmp, file, error);
+        if (error)
+        {
+            std::remove(tmp.data());
+            return orxSTATUS_FAILURE;
+        }
+        stamp = GetStamp(file);
+        return orxSTATUS_SUCCESS;
+    }
+
+    void Report(const std::string &file, orxSTATUS status, bool changed)
+    {
+        if (changed)
+            orxLOG("Config file <%s> changed on disk, not saved over", file.data());
+        else if (status == orxSTATUS_FAILURE)
+            orxLOG("Could not save config file <%s>", file.data());
+    }
+
+    // Runs on a worker thread
+    orxSTATUS orxFASTCALL Run(void *context)
+    {
+        auto task = (Task *)context;
+        trace::Scope scope{"saver::Write"};
+        task->status = Write(task->file, task->content, task->base, task->written, task->changed);
+        task->finished = true;
+        return orxSTATUS_SUCCESS;
+    }
+
+    void Start(const std::string &file, std::string &&content, orxDOUBLE requestTime, const Stamp &base);
+
+    // Set by Exit, which waits for and frees every task itself
+    bool exited = false;
+
+    // Runs on the main thread once the write is done
+    orxSTATUS orxFASTCALL Done(void *context)
+    {
+        if (exited)
+            return orxSTATUS_SUCCESS;
+        auto task = (Task *)context;
+        auto &job = jobs[task->file];
+        job.inFlight = orxFALSE;
+        job.task = nullptr;
+        job.lastStatus = task->status;
+        job.lastLatency = orxSystem_GetTime() - task->requestTime;
+        job.saveCount++;
+        Report(task->file, task->status, task->changed);
+
+        // Start the most recent request made while this one was running, on
+        // top of what it wrote. Without that, it was patched over stale text.
+        if (task->status == orxSTATUS_SUCCESS)
+        {
+            job.stamp = task->written;
+            if (job.pending.has_value())
+            {
+                auto content = std::move(job.pending.value());
+                job.pending.reset();
+                Start(task->file, std::move(content), job.pendingTime, task->written);
+            }
+        }
+        job.pending.reset();
+
+        delete task;
+        return orxSTATUS_SUCCESS;
+    }
+
+    void Start(const std::string &file, std::string &&content, orxDOUBLE requestTime, const Stamp &base)
+    {
+        auto &job = jobs[file];
+        job.inFlight = orxTRUE;
+        job.task = new Task{file, std::move(content), requestTime, base, {}, orxSTATUS_FAILURE, false, false};
+        orxThread_RunTask(Run, orxNULL, Done, job.task);
+    }
+
+    // Queue content patched over file as of base to be written, coalescing
+    // with any save already waiting for the same file
+    void Request(const orxSTRING file, std::string &&content, const Stamp &base)
+    {
+        auto &job = jobs[file];
+        if (job.inFlight)
+        {
+            if (job.pending.has_value())
+                job.coalescedCount++;
+            else
+                job.pendingTime = orxSystem_GetTime();
+            job.pending = std::move(content);
+        }
+        else
+        {
+            Start(file, std::move(content), orxSystem_GetTime(), base);
+        }
+    }
+
+    const Job *GetJob(const orxSTRING file)
+    {
+        auto job = jobs.find(file);
+        return job != jobs.end() ? &job->second : nullptr;
+    }
+
+    // Whether file as of stamp is our own last write. A write in flight is
+    // waited for, it may be landing right now.
+    bool IsWritten(const orxSTRING file, const Stamp &stamp)
+    {
+        auto job = jobs.find(file);
+        if (job == jobs.end())
+            return false;
+        if (auto task = job->second.task)
+        {
+            while (!task->finished)
+                orxSystem_Delay(0.001f);
+            if (task->status == orxSTATUS_SUCCESS && task->written == stamp)
+                return true;
+        }
+        return job->second.stamp == stamp;
+    }
+
+    // Waits for every write in flight, as orx may drop tasks still queued
+    // at shutdown, then writes anything still waiting on the calling thread
+    void Exit()
+    {
+        exited = true;
+        for (auto &[file, job] : jobs)
+        {
+            if (!job.inFlight)
+                continue;
+            while (!job.task->finished)
+                orxSystem_Delay(0.001f);
+            Report(file, job.task->status, job.task->changed);
+            if (job.pending.has_value() && job.task->status == orxSTATUS_SUCCESS)
+            {
+                bool changed;
+                auto status = Write(file, job.pending.value(), job.task->written, job.stamp, changed);
+                Report(file, status, changed);
+            }
+            job.pending.reset();
+            delete job.task;
+            job.task = nullptr;
+            job.inFlight = orxFALSE;
+        }
+    }
 }
 
 namespace config
 {
+    // Sections and keys edited since they were last saved. Whole sections
+    // are marked when their parent changes or they're rewritten wholesale.
+    struct Dirty
+    {
+        bool section = false;
+        std::set<std::string> keys{};
+    };
+
+    std::map<std::string, Dirty, std::less<>> dirty{};
+
+    Dirty &GetDirty(const orxSTRING section)
+    {
+        auto entry = dirty.find(section);
+        if (entry == dirty.end())
+            entry = dirty.emplace(section, Dirty{}).first;
+        return entry->second;
+    }
+
+    void MarkDirty(const orxSTRING section, const orxSTRING key)
+    {
+        GetDirty(section).keys.emplace(key);
+    }
+
+    void MarkSectionDirty(const orxSTRING section)
+    {
+        GetDirty(section).section = true;
+    }
+
     int GetAnimFrames(const orxSTRING animSetName, const orxSTRING animName)
     {
         // Get number of frames in the animation from the animation set
@@ -88,6 +736,7 @@ namespace config
         orxConfig_PushSection(animSetName);
         orxConfig_SetU32(animName, frames);
         orxConfig_PopSection();
+        MarkDirty(animSetName, animName);
     }
 
     const orxSTRING GetAnimSetPrefix(const orxSTRING animSetName)
@@ -98,36 +747,48 @@ namespace config
         return prefix;
     }
 
-    void GetAnimSectionName(const orxSTRING animSetName, const orxSTRING animName, orxSTRING buf, size_t bufSize)
+    // Derived names are interned in orx's string table, so they can be kept
+    // and compared by pointer and are never truncated. Per-frame code uses
+    // the names interned once per set in animset::Index instead.
+    const orxSTRING GetAnimSectionName(const orxSTRING animSetName, const orxSTRING animName)
+    {
+        std::string name{GetAnimSetPrefix(animSetName)};
+        name += animName;
+        return orxString_Store(name.c_str());
+    }
+
+    // Sections overriding single keys of an animation, numbered from 1
+    const orxSTRING GetKeySectionName(const orxSTRING animSectionName, orxU32 key)
     {
-        auto prefix = GetAnimSetPrefix(animSetName);
-        orxString_NPrint(buf, bufSize, "%s%s", prefix, animName);
+        std::string name{animSectionName};
+        name += std::to_string(key);
+        return orxString_Store(name.c_str());
     }
 
-    void GetAnimLinkSource(const orxSTRING animName, orxSTRING out, size_t outLen)
+    const orxSTRING GetAnimLinkSource(const orxSTRING animName)
     {
-        orxString_NPrint(out, outLen, "%s->", animName);
+        std::string name{animName};
+        name += "->";
+        return orxString_Store(name.c_str());
     }
 
-    std::vector<const orxCHAR *> GetAnimLinks(const orxSTRING animSetName, const orxSTRING srcAnim)
+    // Fill dests with the links listed under linkSource, reusing its storage
+    void GetLinks(const orxSTRING animSetName, const orxSTRING linkSource, std::vector<const orxCHAR *> &dests)
     {
         orxConfig_PushSection(animSetName);
-        orxCHAR src[64];
-        GetAnimLinkSource(srcAnim, src, sizeof(src));
-        auto count = orxConfig_GetListCount(src);
-        std::vector<const orxCHAR *> dests{};
+        auto count = orxConfig_GetListCount(linkSource);
         dests.resize(count);
         for (size_t i = 0; i < count; i++)
         {
-            dests[i] = orxConfig_GetListString(src, i);
+            dests[i] = orxConfig_GetListString(linkSource, i);
         }
         orxConfig_PopSection();
-        return dests;
     }
 
-    std::string AnimSourceName(const orxSTRING animName)
+    // Fill dests with the links of srcAnim, reusing its storage
+    void GetAnimLinks(const orxSTRING animSetName, const orxSTRING srcAnim, std::vector<const orxCHAR *> &dests)
     {
-        return std::string{animName} + "->";
+        GetLinks(animSetName, GetAnimLinkSource(srcAnim), dests);
     }
 
     void AddAnimLink(const orxSTRING animSetName, const orxSTRING srcAnim, const orxSTRING dstAnim)
@@ -135,206 +796,3938 @@ namespace config
         orxConfig_PushSection(animSetName);
 
         // Source has a -> suffix
-        auto src = AnimSourceName(srcAnim);
+        auto src = GetAnimLinkSource(srcAnim);
 
-        orxConfig_AppendListString(src.data(), &dstAnim, 1);
+        orxConfig_AppendListString(src, &dstAnim, 1);
         orxConfig_PopSection();
+        MarkDirty(animSetName, src);
     }
 
     void SetAnimLinks(const orxSTRING animSetName, const orxSTRING srcAnim, std::vector<std::string> &dstAnims)
     {
-        auto src = AnimSourceName(srcAnim);
+        auto src = GetAnimLinkSource(srcAnim);
         orxConfig_PushSection(animSetName);
         if (dstAnims.size() > 0)
         {
             orxCHAR *links[dstAnims.size()];
             for (int i = 0; i < dstAnims.size(); i++)
                 links[i] = dstAnims[i].data();
-            orxConfig_SetListString(src.data(), (const orxCHAR **)links, dstAnims.size());
+            orxConfig_SetListString(src, (const orxCHAR **)links, dstAnims.size());
         }
         else
         {
-            orxConfig_ClearValue(src.data());
+            orxConfig_ClearValue(src);
+        }
+        orxConfig_PopSection();
+        MarkDirty(animSetName, src);
+    }
+
+    void AddStartAnim(const orxSTRING animSetName, const orxSTRING animName)
+    {
+        orxConfig_PushSection(animSetName);
+        orxConfig_AppendListString("StartAnimList", &animName, 1);
+        orxConfig_PopSection();
+        MarkDirty(animSetName, "StartAnimList");
+    }
+
+    // Resolve the file a config section was loaded from
+    const orxSTRING GetOriginPath(const orxSTRING section)
+    {
+        auto origin = orxConfig_GetOrigin(section);
+        auto location = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, origin);
+        return location != orxNULL ? orxResource_GetPath(location) : origin;
+    }
+
+    // Append a key's values in the format used by config files
+    void SerializeValue(const orxSTRING key, std::string &out)
+    {
+        auto count = orxConfig_GetListCount(key);
+        for (orxS32 j = 0; j < count; j++)
+        {
+            if (j > 0)
+                out += " # ";
+            out += orxConfig_GetListString(key, j);
+        }
+    }
+
+    // Append a section's own keys to out, in the format used by config files
+    void SerializeSection(const orxSTRING section, std::string &out)
+    {
+        auto parent = orxConfig_GetParent(section);
+        out += "[";
+        out += section;
+        if (parent != orxNULL)
+        {
+            out += "@";
+            out += parent;
+        }
+        out += "]\n";
+
+        orxConfig_PushSection(section);
+        auto keyCount = orxConfig_GetKeyCount();
+        for (orxU32 i = 0; i < keyCount; i++)
+        {
+            auto key = orxConfig_GetKey(i);
+            out += key;
+            out += " = ";
+            SerializeValue(key, out);
+            out += "\n";
+        }
+        orxConfig_PopSection();
+        out += "\n";
+    }
+
+    // Byte range in a config file
+    struct Span
+    {
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    struct KeySpan
+    {
+        // Whole line with its newline, and the value alone
+        Span line;
+        Span value;
+    };
+
+    struct SectionSpan
+    {
+        // Name and parent, between the brackets
+        Span header;
+        // New keys go after the last key line
+        size_t end = 0;
+        std::unordered_map<std::string, KeySpan> keys{};
+    };
+
+    // A config file as last saved, parsed once so saves only patch the
+    // ranges that changed and leave comments and @includes@ alone
+    struct Document
+    {
+        std::string text{};
+        const orxCHAR *newline = "\n";
+        std::unordered_map<std::string, SectionSpan> sections{};
+        // The file text was read from or written to, to notice hand edits
+        saver::Stamp stamp{};
+    };
+
+    struct Edit
+    {
+        size_t begin;
+        size_t end;
+        std::string text;
+        // Replaces a key's value and nothing else, so spans only move
+        bool value = false;
+    };
+
+    std::map<std::string, Document, std::less<>> documents{};
+
+    // Find sections and keys, the last definition of each wins as in orx
+    void IndexDocument(Document &document)
+    {
+        const auto &text = document.text;
+        document.sections.clear();
+        SectionSpan *section = nullptr;
+        for (size_t begin = 0, end = 0; begin < text.size(); begin = end)
+        {
+            auto newline = text.find('\n', begin);
+            end = newline != std::string::npos ? newline + 1 : text.size();
+            auto first = text.find_first_not_of(" \t", begin);
+            if (first >= end || text[first] == ';' || text[first] == '@' || text[first] == '\r' || text[first] == '\n')
+                continue;
+
+            if (text[first] == '[' || (text[first] == '!' && text[first + 1] == '['))
+            {
+                auto open = text.find('[', first);
+                auto close = text.find(']', open);
+                section = nullptr;
+                if (close >= end)
+                    continue;
+                auto nameEnd = orxMIN(text.find('@', open), close);
+                section = &document.sections[text.substr(open + 1, nameEnd - open - 1)];
+                section->header = {open + 1, close};
+                section->end = end;
+                continue;
+            }
+
+            auto equal = text.find('=', first);
+            if (section == nullptr || equal >= end)
+                continue;
+            auto keyEnd = text.find_last_not_of(" \t", equal - 1) + 1;
+            auto valueBegin = orxMIN(text.find_first_not_of(" \t", equal + 1), end);
+            auto valueEnd = valueBegin;
+            if (valueBegin < end && text[valueBegin] == '"')
+            {
+                auto quote = text.find('"', valueBegin + 1);
+                valueEnd = quote < end ? quote + 1 : end;
+            }
+            valueEnd = orxMIN(text.find(';', valueEnd), end);
+            while (valueEnd > valueBegin && std::isspace((unsigned char)text[valueEnd - 1]))
+                valueEnd--;
+            section->keys[text.substr(first, keyEnd - first)] = {{begin, end}, {valueBegin, valueEnd}};
+            section->end = end;
+        }
+    }
+
+    // Move spans past value edits, sorted and applied to document.text, by
+    // the change in length of the edits before them
+    void ShiftSpans(Document &document, const std::vector<Edit> &edits)
+    {
+        std::vector<std::ptrdiff_t> deltas(edits.size());
+        std::ptrdiff_t delta = 0;
+        for (size_t i = 0; i < edits.size(); i++)
+        {
+            delta += (std::ptrdiff_t)edits[i].text.size() - (std::ptrdiff_t)(edits[i].end - edits[i].begin);
+            deltas[i] = delta;
+        }
+        // Edits starting before position, which end at or before it
+        auto find = [&edits](size_t position)
+        {
+            return (size_t)(std::lower_bound(edits.begin(), edits.end(), position, [](const Edit &edit, size_t position)
+                                             { return edit.begin < position; }) -
+                            edits.begin());
+        };
+        auto shift = [&](size_t position)
+        {
+            auto count = find(position);
+            return count > 0 ? position + deltas[count - 1] : position;
+        };
+
+        for (auto &[name, section] : document.sections)
+        {
+            section.header = {shift(section.header.begin), shift(section.header.end)};
+            section.end = shift(section.end);
+            for (auto &[key, keySpan] : section.keys)
+            {
+                auto &[line, value] = keySpan;
+                line = {shift(line.begin), shift(line.end)};
+                // Values are edited whole, empty ones too
+                auto count = find(value.begin);
+                auto length = value.end - value.begin;
+                if (count < edits.size() && edits[count].begin == value.begin)
+                    length = edits[count].text.size();
+                value.begin = shift(value.begin);
+                value.end = value.begin + length;
+            }
+        }
+    }
+
+    // Read once, then again whenever the file changed on disk other than by
+    // our own writes. Until those land, text is newer than the file.
+    Document &GetDocument(const orxSTRING file)
+    {
+        auto [entry, created] = documents.try_emplace(file);
+        auto &document = entry->second;
+        auto stamp = saver::GetStamp(file);
+        if (!created && stamp != document.stamp && saver::IsWritten(file, stamp))
+            document.stamp = stamp;
+        if (created || stamp != document.stamp)
+        {
+            document = Document{};
+            document.stamp = stamp;
+            if (auto handle = std::fopen(file, "rb"))
+            {
+                orxCHAR buffer[4096];
+                for (size_t read; (read = std::fread(buffer, 1, sizeof(buffer), handle)) > 0;)
+                    document.text.append(buffer, read);
+                std::fclose(handle);
+            }
+            if (document.text.find("\r\n") != std::string::npos)
+                document.newline = "\r\n";
+            IndexDocument(document);
+        }
+        return document;
+    }
+
+    void AppendLine(const Document &document, const std::string &line, std::string &out)
+    {
+        out += line;
+        out += document.newline;
+    }
+
+    // Whether two list items are the same value: equal vectors or numbers
+    // when both parse as such, equal text otherwise
+    bool IsSameItem(const std::string &a, const orxSTRING b)
+    {
+        auto parses = [](const orxSTRING item, auto convert, auto &out)
+        {
+            const orxCHAR *remaining = orxNULL;
+            return convert(item, &out, &remaining) == orxSTATUS_SUCCESS && *orxString_SkipWhiteSpaces(remaining) == orxCHAR_NULL;
+        };
+        orxVECTOR vectorA, vectorB;
+        if (parses(a.c_str(), orxString_ToVector, vectorA) && parses(b, orxString_ToVector, vectorB))
+            return orxVector_AreEqual(&vectorA, &vectorB);
+        orxFLOAT floatA, floatB;
+        if (parses(a.c_str(), orxString_ToFloat, floatA) && parses(b, orxString_ToFloat, floatB))
+            return floatA == floatB;
+        return a == b;
+    }
+
+    // Whether the text of a value in a config file reads as key's current
+    // value in the pushed section, so formatting alone never rewrites a line
+    bool IsSameValue(std::string_view text, const orxSTRING key)
+    {
+        // Items are split on # outside of quotes, and unquoted
+        std::vector<std::string> items(1);
+        bool quoted = false;
+        for (auto c : text)
+        {
+            if (c == '"')
+                quoted = !quoted;
+            else if (c == '#' && !quoted)
+                items.emplace_back();
+            else
+                items.back() += c;
+        }
+        for (auto &item : items)
+        {
+            auto first = item.find_first_not_of(" \t");
+            item = first != std::string::npos ? item.substr(first, item.find_last_not_of(" \t") + 1 - first) : std::string{};
+        }
+
+        auto count = orxConfig_GetListCount(key);
+        if ((orxS32)items.size() != orxMAX(count, 1))
+            return false;
+        if (count == 0)
+            return items.front().empty();
+        for (orxS32 i = 0; i < count; i++)
+        {
+            if (!IsSameItem(items[i], orxConfig_GetListString(key, i)))
+                return false;
+        }
+        return true;
+    }
+
+    // Whether a reference (@Section, @Section.Key or @.Key) reads as key's
+    // current value in the pushed section
+    bool IsSameReference(std::string_view text, const orxSTRING section, const orxSTRING key)
+    {
+        auto dot = text.find('.');
+        std::string referredSection{text.substr(1, dot != std::string_view::npos ? dot - 1 : std::string_view::npos)};
+        std::string referredKey{dot != std::string_view::npos ? text.substr(dot + 1) : std::string_view{key}};
+        if (referredSection.empty())
+            referredSection = section;
+        if (!orxConfig_HasSection(referredSection.c_str()))
+            return false;
+
+        std::vector<std::string> values{};
+        for (orxS32 i = 0, count = orxConfig_GetListCount(key); i < count; i++)
+            values.emplace_back(orxConfig_GetListString(key, i));
+        orxConfig_PushSection(referredSection.c_str());
+        auto same = orxConfig_HasValue(referredKey.c_str()) && orxConfig_GetListCount(referredKey.c_str()) == (orxS32)values.size();
+        for (orxS32 i = 0; same && i < (orxS32)values.size(); i++)
+            same = values[i] == orxConfig_GetListString(referredKey.c_str(), i);
+        orxConfig_PopSection();
+        return same;
+    }
+
+    // Queue the edits bringing one section of document in line with config.
+    // Lines are only rewritten when their value changed: formatting, and
+    // references (Key = @Section[.Key]) orx still resolves, stay as written.
+    void PatchSection(const Document &document, const orxSTRING section, const Dirty &marks, std::vector<Edit> &edits)
+    {
+        auto exists = orxConfig_HasSection(section);
+        auto found = document.sections.find(section);
+        if (found == document.sections.end())
+        {
+            if (!exists)
+                return;
+            orxConfig_PushSection(section);
+            auto keyCount = orxConfig_GetKeyCount();
+            orxConfig_PopSection();
+            if (keyCount == 0)
+                return;
+
+            // New sections go at the end of the file
+            std::string serialized{};
+            SerializeSection(section, serialized);
+            std::string text{};
+            if (!document.text.empty() && document.text.back() != '\n')
+                text += document.newline;
+            for (size_t begin = 0, end; (end = serialized.find('\n', begin)) != std::string::npos; begin = end + 1)
+                AppendLine(document, serialized.substr(begin, end - begin), text);
+            edits.push_back({document.text.size(), document.text.size(), std::move(text)});
+            return;
+        }
+        const auto &span = found->second;
+
+        // Whole sections are compared key by key, so comments between keys stay
+        std::set<std::string> keys{marks.keys};
+        if (marks.section)
+        {
+            for (const auto &[key, keySpan] : span.keys)
+                keys.insert(key);
+            if (exists)
+            {
+                orxConfig_PushSection(section);
+                for (orxU32 i = 0, count = orxConfig_GetKeyCount(); i < count; i++)
+                    keys.insert(orxConfig_GetKey(i));
+                orxConfig_PopSection();
+            }
+        }
+
+        if (exists)
+            orxConfig_PushSection(section);
+        std::string inserted{};
+        for (const auto &key : keys)
+        {
+            auto has = exists && orxConfig_HasValue(key.c_str()) && !orxConfig_IsInheritedValue(key.c_str());
+            auto keySpan = span.keys.find(key);
+            if (keySpan == span.keys.end())
+            {
+                if (!has)
+                    continue;
+                std::string line{key};
+                line += " = ";
+                SerializeValue(key.c_str(), line);
+                AppendLine(document, line, inserted);
+                continue;
+            }
+
+            const auto &[line, value] = keySpan->second;
+            auto text = std::string_view{document.text}.substr(value.begin, value.end - value.begin);
+            if (exists && orxConfig_HasValue(key.c_str()) && !text.empty() && text.front() == '@' && IsSameReference(text, section, key.c_str()))
+                continue;
+            if (!has)
+            {
+                edits.push_back({line.begin, line.end, {}});
+                continue;
+            }
+            if (IsSameValue(text, key.c_str()))
+                continue;
+            std::string serialized{};
+            SerializeValue(key.c_str(), serialized);
+            edits.push_back({value.begin, value.end, std::move(serialized), true});
+        }
+        if (exists)
+            orxConfig_PopSection();
+
+        if (!inserted.empty())
+        {
+            if (document.text[span.end - 1] != '\n')
+                inserted.insert(0, document.newline);
+            edits.push_back({span.end, span.end, std::move(inserted)});
+        }
+
+        // The parent is only known to change with whole sections
+        if (marks.section)
+        {
+            if (exists)
+            {
+                std::string header{section};
+                if (auto parent = orxConfig_GetParent(section))
+                {
+                    header += "@";
+                    header += parent;
+                }
+                if (document.text.compare(span.header.begin, span.header.end - span.header.begin, header) != 0)
+                    edits.push_back({span.header.begin, span.header.end, std::move(header)});
+            }
+            else
+            {
+                auto lineBegin = document.text.rfind('\n', span.header.begin);
+                lineBegin = lineBegin != std::string::npos ? lineBegin + 1 : 0;
+                auto lineEnd = document.text.find('\n', span.header.end);
+                lineEnd = lineEnd != std::string::npos ? lineEnd + 1 : document.text.size();
+                edits.push_back({lineBegin, lineEnd, {}});
+            }
+        }
+    }
+
+    // Patch the dirty sections in owned, and the per-key sections of those,
+    // into the files defining them and queue those to be written in the
+    // background. Sections without a file of their own, new or removed,
+    // follow the section owning them, then file.
+    void SaveSections(const orxSTRING file, const std::unordered_set<std::string_view> &owned)
+    {
+        auto getOwner = [&owned](std::string_view section) -> std::string_view
+        {
+            if (owned.count(section) > 0)
+                return section;
+            // Key sections are their animation's section followed by a number
+            for (auto length = section.size(); length > 0 && std::isdigit((unsigned char)section[length - 1]); length--)
+            {
+                if (owned.count(section.substr(0, length - 1)) > 0)
+                    return section.substr(0, length - 1);
+            }
+            return {};
+        };
+        auto getOrigin = [](std::string_view section) -> std::string
+        {
+            std::string name{section};
+            if (!orxConfig_HasSection(name.c_str()))
+                return {};
+            auto origin = orxConfig_GetOrigin(name.c_str());
+            return origin != orxNULL && *origin != orxCHAR_NULL ? GetOriginPath(name.c_str()) : std::string{};
+        };
+
+        std::map<std::string, std::vector<std::pair<std::string, Dirty>>> byFile{};
+        for (auto entry = dirty.begin(); entry != dirty.end();)
+        {
+            auto owner = getOwner(entry->first);
+            if (owner.empty())
+            {
+                ++entry;
+                continue;
+            }
+            auto origin = getOrigin(entry->first);
+            if (origin.empty())
+                origin = getOrigin(owner);
+            if (origin.empty())
+                origin = file;
+            byFile[origin].emplace_back(entry->first, std::move(entry->second));
+            entry = dirty.erase(entry);
+        }
+
+        for (const auto &[path, sections] : byFile)
+        {
+            auto &document = GetDocument(path.c_str());
+            std::vector<Edit> edits{};
+            for (const auto &[section, marks] : sections)
+                PatchSection(document, section.c_str(), marks, edits);
+            if (edits.empty())
+                continue;
+
+            // Untouched ranges are copied as they are
+            std::stable_sort(edits.begin(), edits.end(), [](const Edit &a, const Edit &b)
+                             { return a.begin != b.begin ? a.begin < b.begin : a.end < b.end; });
+            std::string text{};
+            text.reserve(document.text.size());
+            size_t copied = 0;
+            for (const auto &edit : edits)
+            {
+                text.append(document.text, copied, edit.begin - copied);
+                text += edit.text;
+                copied = edit.end;
+            }
+            text.append(document.text, copied, std::string::npos);
+            document.text = std::move(text);
+
+            // Changed values only move spans, new or removed lines need parsing
+            if (std::all_of(edits.begin(), edits.end(), [](const Edit &edit)
+                            { return edit.value; }))
+                ShiftSpans(document, edits);
+            else
+                IndexDocument(document);
+
+            saver::Request(path.c_str(), std::string{document.text}, document.stamp);
+        }
+    }
+
+    // Patch the animation set's edited sections into the files defining
+    // them, file for new ones
+    void Save(const orxSTRING file, orxOBJECT *object)
+    {
+        PROFILE_SCOPE("config::Save");
+
+        auto animSet = object::GetAnimSet(object);
+        const auto &index = animset::GetIndex(animSet);
+        std::unordered_set<std::string_view> owned{orxAnimSet_GetName(animSet)};
+        owned.insert(index.sectionNames.begin(), index.sectionNames.end());
+        SaveSections(file, owned);
+    }
+
+}
+
+namespace animset
+{
+    const Index &GetIndex(const orxANIMSET *animSet)
+    {
+        auto [entry, created] = indices.try_emplace(orxStructure_GetGUID(animSet));
+        auto &index = entry->second;
+        if (created)
+        {
+            index.anims = GetAnims(animSet);
+
+            auto animSetName = orxAnimSet_GetName(animSet);
+            index.positions.resize(index.anims.size());
+            for (auto anim : index.anims)
+            {
+                // Interned too, so models outlive the animations they name
+                auto name = orxString_Store(orxAnim_GetName(anim));
+                auto animID = orxAnimSet_GetAnimIDFromName(animSet, name);
+                index.positions[animID] = index.ids.size();
+                index.ids.push_back(animID);
+                index.names.push_back(name);
+                index.sectionNames.push_back(config::GetAnimSectionName(animSetName, name));
+                index.linkSources.push_back(config::GetAnimLinkSource(name));
+                index.frameCounts.push_back(orxAnim_GetKeyCount(anim));
+            }
+        }
+        return index;
+    }
+
+    // Interned section name of an animation, by animation ID
+    const orxSTRING GetSectionName(const orxANIMSET *animSet, orxU32 animID)
+    {
+        const auto &index = GetIndex(animSet);
+        return index.sectionNames[index.positions[animID]];
+    }
+
+    // Drop all indices, animations are swapped or re-created by a rebuild
+    void InvalidateIndices()
+    {
+        indices.clear();
+    }
+}
+
+namespace rebuild
+{
+    // Animations whose config changed since the last rebuild. These can be
+    // patched into the live animation set one at a time.
+    std::set<std::string> dirtyAnims{};
+
+    // Set-level changes (links, new animations, frame size, ...) which
+    // require the whole object to be re-created
+    orxBOOL structural = orxFALSE;
+
+    // Changes are coalesced until no edit has been made for this long, or
+    // until the widget being edited is released
+    orxFLOAT settleDelay = orxFLOAT_0;
+    orxDOUBLE lastChangeTime = orxDOUBLE_0;
+
+    // Rebuild statistics
+    orxU32 patchCount = 0;
+    orxU32 recreateCount = 0;
+    orxU32 avoidedCount = 0;
+
+    void Init()
+    {
+        orxConfig_PushSection("AnimTester");
+        settleDelay = orxMAX(orxFLOAT_0, orxConfig_GetFloat("RebuildDelay"));
+        orxConfig_PopSection();
+    }
+
+    orxBOOL IsPending()
+    {
+        return structural || !dirtyAnims.empty();
+    }
+
+    void Touch()
+    {
+        // Any change made while one is already waiting is folded into it
+        if (IsPending())
+            avoidedCount++;
+        lastChangeTime = orxSystem_GetTime();
+    }
+
+    void MarkAnim(const orxSTRING animName)
+    {
+        Touch();
+        dirtyAnims.insert(animName);
+    }
+
+    void MarkStructural()
+    {
+        Touch();
+        structural = orxTRUE;
+    }
+
+    orxBOOL IsSettled()
+    {
+        return !ImGui::IsAnyItemActive() || orxSystem_GetTime() - lastChangeTime >= settleDelay;
+    }
+
+    void Clear()
+    {
+        dirtyAnims.clear();
+        structural = orxFALSE;
+    }
+
+    // Patch the dirty animations into the object's live animation set,
+    // keeping the object, its graphic and the rest of the set untouched
+    orxBOOL PatchAnims(orxOBJECT *object)
+    {
+        auto animPointer = orxOBJECT_GET_STRUCTURE(object, ANIMPOINTER);
+        auto animSet = object::GetAnimSet(object);
+        auto animSetName = orxAnimSet_GetName(animSet);
+
+        // Create all replacement animations first so a failure leaves the
+        // live set untouched
+        std::vector<std::pair<orxU32, orxANIM *>> replacements{};
+        auto patchable = orxTRUE;
+        for (const auto &name : dirtyAnims)
+        {
+            auto animID = orxAnimSet_GetAnimIDFromName(animSet, name.data());
+            auto anim = animID != orxU32_UNDEFINED ? animset::CreateAnimFromConfig(animSetName, animset::GetSectionName(animSet, animID), name.data()) : orxNULL;
+            if (anim == orxNULL)
+            {
+                patchable = orxFALSE;
+                break;
+            }
+            replacements.emplace_back(animID, anim);
+        }
+
+        if (patchable)
+        {
+            // Keep the set alive while it has no animation pointer; sets are
+            // locked while referenced by one
+            auto currentAnim = orxAnimPointer_GetCurrentAnim(animPointer);
+            auto targetAnim = orxAnimPointer_GetTargetAnim(animPointer);
+            auto time = orxAnimPointer_GetTime(animPointer);
+            auto frequency = orxAnimPointer_GetFrequency(animPointer);
+            orxStructure_IncreaseCount(animSet);
+            orxObject_UnlinkStructure(object, orxSTRUCTURE_ID_ANIMPOINTER);
+
+            for (auto [animID, anim] : replacements)
+            {
+                if (!animset::ReplaceAnim(animSet, animID, anim))
+                {
+                    patchable = orxFALSE;
+                    break;
+                }
+            }
+
+            if (patchable)
+            {
+                animPointer = orxAnimPointer_Create(animSet);
+                orxObject_LinkStructure(object, orxSTRUCTURE(animPointer));
+                orxStructure_SetOwner(animPointer, object);
+                orxAnimPointer_SetCurrentAnim(animPointer, currentAnim);
+                if (targetAnim != orxU32_UNDEFINED)
+                    orxAnimPointer_SetTargetAnim(animPointer, targetAnim);
+                orxAnimPointer_SetTime(animPointer, time);
+                orxAnimPointer_SetFrequency(animPointer, frequency);
+            }
+
+            // Release our reference, a broken set gets freed here and
+            // re-created from config by the full rebuild
+            orxAnimSet_Delete(animSet);
+        }
+
+        // The set holds its own references to the animations it kept
+        for (auto [animID, anim] : replacements)
+        {
+            orxAnim_Delete(anim);
+        }
+
+        return patchable;
+    }
+
+    // Delete and re-create the object from config
+    orxOBJECT *Recreate(orxOBJECT *object)
+    {
+        // Get some animation information for the current object so we can
+        // propagate it to the replacement object.
+        auto currentAnimation = orxObject_GetCurrentAnim(object);
+        auto targetAnimation = orxObject_GetTargetAnim(object);
+        auto animationTime = orxObject_GetAnimTime(object);
+        auto name = orxObject_GetName(object);
+
+        // Delete to current object so that the associated animset is freed
+        // now, rather than potentially delaying the deletion until the next
+        // frame. Then we can create a new object using the update config
+        // values.
+        orxObject_Delete(object);
+
+        // Create a new object and align its animation and animation time to
+        // the values for the previous target object.
+        object = orxObject_CreateFromConfig(name);
+        orxASSERT(object);
+        if (currentAnimation != orxNULL)
+        {
+            // A failed patch leaves the old object without an animation
+            orxObject_SetCurrentAnim(object, currentAnimation);
+            orxObject_SetTargetAnim(object, targetAnimation);
+            orxObject_SetAnimTime(object, animationTime);
+        }
+
+        return object;
+    }
+
+    // Apply pending changes, patching animations in place when possible
+    orxOBJECT *Apply(orxOBJECT *object)
+    {
+        PROFILE_SCOPE("rebuild::Apply");
+        animset::InvalidateIndices();
+        if (structural || !PatchAnims(object))
+        {
+            object = Recreate(object);
+            recreateCount++;
+        }
+        else
+        {
+            patchCount++;
+        }
+        Clear();
+        return object;
+    }
+}
+
+namespace model
+{
+    // Typed copy of an animation set's config, loaded once per set. The UI
+    // reads from it and setters write through to config only when a value
+    // actually changes, marking what needs rebuilding.
+    struct Anim
+    {
+        // Interned, from animset::Index
+        const orxCHAR *name = orxNULL;
+        const orxCHAR *section = orxNULL;
+        orxS32 frames = 0;
+        orxFLOAT keyDuration = orxFLOAT_0;
+        std::string rowOrder{};
+        std::string columnOrder{};
+        std::string textureSize{};
+        orxVECTOR textureOrigin = orxVECTOR_0;
+        std::vector<std::string> links{};
+        // 1-based keys with a section of their own overriding some values
+        std::vector<orxU32> keyOverrides{};
+    };
+
+    struct AnimSet
+    {
+        std::string name{};
+        std::string originPath{};
+        std::string texture{};
+        orxVECTOR frameSize = orxVECTOR_0;
+        std::vector<Anim> anims{};
+    };
+
+    // Keyed by animation set GUID, like animset::indices; a re-created set
+    // loads a fresh model
+    std::map<orxU64, AnimSet> sets{};
+
+    void LoadAnim(const orxSTRING animSetName, const animset::Index &index, size_t position, Anim &anim)
+    {
+        auto sectionName = index.sectionNames[position];
+        anim.name = index.names[position];
+        anim.section = sectionName;
+        anim.frames = config::GetAnimFrames(animSetName, anim.name);
+
+        std::vector<const orxCHAR *> links{};
+        config::GetLinks(animSetName, index.linkSources[position], links);
+        anim.links.assign(links.begin(), links.end());
+
+        orxConfig_PushSection(sectionName);
+        anim.keyDuration = orxConfig_GetFloat("KeyDuration");
+        anim.rowOrder = orxConfig_GetListString("Direction", 0);
+        anim.columnOrder = orxConfig_GetListString("Direction", 1);
+        anim.textureSize = orxConfig_GetString("TextureSize");
+        anim.textureOrigin = orxVECTOR_0;
+        orxConfig_GetVector("TextureOrigin", &anim.textureOrigin);
+        orxConfig_PopSection();
+
+        for (orxS32 key = 1; key <= anim.frames; key++)
+        {
+            auto keySection = config::GetKeySectionName(sectionName, key);
+            if (!orxConfig_HasSection(keySection))
+                continue;
+            orxConfig_PushSection(keySection);
+            if (orxConfig_GetKeyCount() > 0)
+                anim.keyOverrides.push_back(key);
+            orxConfig_PopSection();
+        }
+    }
+
+    AnimSet &Get(const orxANIMSET *animSet)
+    {
+        auto guid = orxStructure_GetGUID(animSet);
+        auto [entry, created] = sets.try_emplace(guid);
+        auto &set = entry->second;
+        if (created)
+        {
+            // Only the target object's set is edited, models of the sets it
+            // replaced are stale
+            for (auto other = sets.begin(); other != sets.end();)
+                other = other->first != guid ? sets.erase(other) : std::next(other);
+
+            auto animSetName = orxAnimSet_GetName(animSet);
+            set.name = animSetName;
+            set.originPath = config::GetOriginPath(animSetName);
+            orxConfig_PushSection(animSetName);
+            set.texture = orxConfig_GetString("Texture");
+            orxConfig_GetVector("FrameSize", &set.frameSize);
+            orxConfig_PopSection();
+
+            const auto &index = animset::GetIndex(animSet);
+            set.anims.resize(index.names.size());
+            for (size_t i = 0; i < index.names.size(); i++)
+                LoadAnim(animSetName, index, i, set.anims[i]);
+        }
+        return set;
+    }
+
+    // Drop every model, for edits made straight to config such as trimming
+    // and for files reloaded from disk
+    void Invalidate()
+    {
+        sets.clear();
+    }
+
+    void SetFrameSize(AnimSet &set, const orxVECTOR &frameSize)
+    {
+        if (orxVector_AreEqual(&set.frameSize, &frameSize))
+            return;
+        rebuild::MarkStructural();
+        orxVector_Copy(&set.frameSize, &frameSize);
+        orxConfig_PushSection(set.name.c_str());
+        orxConfig_SetVector("FrameSize", &set.frameSize);
+        orxConfig_PopSection();
+        config::MarkDirty(set.name.c_str(), "FrameSize");
+    }
+
+    void SetFrames(AnimSet &set, Anim &anim, orxS32 frames)
+    {
+        if (anim.frames == frames)
+            return;
+        rebuild::MarkAnim(anim.name);
+        anim.frames = frames;
+        config::SetAnimFrames(set.name.c_str(), anim.name, frames);
+    }
+
+    void SetKeyDuration(Anim &anim, orxFLOAT keyDuration)
+    {
+        if (anim.keyDuration == keyDuration)
+            return;
+        rebuild::MarkAnim(anim.name);
+        anim.keyDuration = keyDuration;
+        orxConfig_PushSection(anim.section);
+        orxConfig_SetFloat("KeyDuration", keyDuration);
+        orxConfig_PopSection();
+        config::MarkDirty(anim.section, "KeyDuration");
+    }
+
+    void SetDirection(Anim &anim, const orxSTRING rowOrder, const orxSTRING columnOrder)
+    {
+        if (anim.rowOrder == rowOrder && anim.columnOrder == columnOrder)
+            return;
+        rebuild::MarkAnim(anim.name);
+        anim.rowOrder = rowOrder;
+        anim.columnOrder = columnOrder;
+        const orxCHAR *direction[] = {rowOrder, columnOrder};
+        orxConfig_PushSection(anim.section);
+        orxConfig_SetListString("Direction", direction, 2);
+        orxConfig_PopSection();
+        config::MarkDirty(anim.section, "Direction");
+    }
+
+    void SetTextureSize(Anim &anim, const orxSTRING textureSize)
+    {
+        if (anim.textureSize == textureSize)
+            return;
+        rebuild::MarkAnim(anim.name);
+        anim.textureSize = textureSize;
+        orxConfig_PushSection(anim.section);
+        orxConfig_SetString("TextureSize", textureSize);
+        orxConfig_PopSection();
+        config::MarkDirty(anim.section, "TextureSize");
+    }
+
+    void SetTextureOrigin(Anim &anim, const orxVECTOR &textureOrigin)
+    {
+        if (orxVector_AreEqual(&anim.textureOrigin, &textureOrigin))
+            return;
+        rebuild::MarkAnim(anim.name);
+        orxVector_Copy(&anim.textureOrigin, &textureOrigin);
+        orxConfig_PushSection(anim.section);
+        orxConfig_SetVector("TextureOrigin", &anim.textureOrigin);
+        orxConfig_PopSection();
+        config::MarkDirty(anim.section, "TextureOrigin");
+    }
+
+    void SetLinks(AnimSet &set, Anim &anim, std::vector<std::string> &&links)
+    {
+        if (anim.links == links)
+            return;
+        rebuild::MarkStructural();
+        anim.links = std::move(links);
+        config::SetAnimLinks(set.name.c_str(), anim.name, anim.links);
+    }
+
+    // New animations show up once the set is re-created with them
+    void AddAnim(AnimSet &set, const orxSTRING name)
+    {
+        rebuild::MarkStructural();
+
+        config::SetAnimFrames(set.name.c_str(), name, 1);
+        config::AddStartAnim(set.name.c_str(), name);
+
+        auto sectionName = config::GetAnimSectionName(set.name.c_str(), name);
+        orxConfig_PushSection(sectionName);
+        orxConfig_SetFloat("KeyDuration", 0.1);
+        orxConfig_SetVector("TextureOrigin", &orxVECTOR_0);
+        orxConfig_PopSection();
+        config::MarkSectionDirty(sectionName);
+    }
+}
+
+namespace graph
+{
+    // Transition graph of an animation set, built once per set from its
+    // links. Nodes are positions in animset::Index. Reachability queries
+    // are bit lookups in a transitive closure, which is computed over
+    // strongly connected components so it stays cheap on large sets.
+    const orxS32 defaultPriority = 8;
+
+    struct Edge
+    {
+        orxU32 to;
+        // Link prefixes: + and - raise and lower the priority, . makes the
+        // link immediate and ! clears the target
+        orxS32 priority;
+        bool immediate;
+        bool clearTarget;
+    };
+
+    struct Graph
+    {
+        orxU32 nodeCount = 0;
+        // Edges of node i are edges[offsets[i]] up to edges[offsets[i + 1]]
+        std::vector<orxU32> offsets{};
+        std::vector<Edge> edges{};
+        // Link destinations which aren't animations of the set
+        std::vector<std::pair<orxU32, std::string>> dangling{};
+        std::vector<orxU32> starts{};
+        // Strongly connected component of each node; components are
+        // numbered in reverse topological order, sinks first
+        std::vector<orxU32> components{};
+        std::vector<orxU32> componentSizes{};
+        // Transitive closure, one row of node bits per component
+        size_t rowWords = 0;
+        std::vector<orxU64> closure{};
+        // Breadth-first tree from the start animations
+        std::vector<orxU32> depths{};
+        std::vector<orxU32> parents{};
+        // Nodes without links to any other node
+        std::vector<bool> deadEnds{};
+        orxU32 unreachableCount = 0;
+        orxU32 deadEndCount = 0;
+        orxDOUBLE buildTime = 0.0;
+
+        // Whether to can be reached from from, every node reaches itself
+        bool CanReach(orxU32 from, orxU32 to) const
+        {
+            return (closure[components[from] * rowWords + to / 64] >> (to % 64)) & 1;
+        }
+
+        bool IsReachable(orxU32 node) const
+        {
+            return depths[node] != orxU32_UNDEFINED;
+        }
+
+        // Shortest chain of transitions from a start animation to node
+        std::vector<orxU32> GetPathFromStart(orxU32 node) const
+        {
+            std::vector<orxU32> path{};
+            if (!IsReachable(node))
+                return path;
+            for (auto current = node; current != orxU32_UNDEFINED; current = parents[current])
+                path.push_back(current);
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+    };
+
+    // Keyed by animation set GUID, like animset::indices
+    std::map<orxU64, Graph> graphs{};
+
+    // Tarjan's algorithm with an explicit call stack, so long chains of
+    // links don't overflow the native one
+    void FindComponents(Graph &graph)
+    {
+        auto nodeCount = graph.nodeCount;
+        std::vector<orxU32> order(nodeCount, orxU32_UNDEFINED);
+        std::vector<orxU32> lowLinks(nodeCount, 0);
+        std::vector<bool> onStack(nodeCount, false);
+        std::vector<orxU32> stack{};
+        std::vector<std::pair<orxU32, orxU32>> calls{};
+        graph.components.assign(nodeCount, orxU32_UNDEFINED);
+        orxU32 counter = 0;
+
+        auto visit = [&](orxU32 node)
+        {
+            order[node] = lowLinks[node] = counter++;
+            stack.push_back(node);
+            onStack[node] = true;
+            calls.emplace_back(node, graph.offsets[node]);
+        };
+
+        for (orxU32 root = 0; root < nodeCount; root++)
+        {
+            if (order[root] != orxU32_UNDEFINED)
+                continue;
+            visit(root);
+            while (!calls.empty())
+            {
+                auto node = calls.back().first;
+                auto &edge = calls.back().second;
+                if (edge < graph.offsets[node + 1])
+                {
+                    auto to = graph.edges[edge++].to;
+                    if (order[to] == orxU32_UNDEFINED)
+                        visit(to);
+                    else if (onStack[to])
+                        lowLinks[node] = orxMIN(lowLinks[node], order[to]);
+                    continue;
+                }
+
+                calls.pop_back();
+                if (lowLinks[node] == order[node])
+                {
+                    auto component = (orxU32)graph.componentSizes.size();
+                    orxU32 size = 0;
+                    orxU32 member;
+                    do
+                    {
+                        member = stack.back();
+                        stack.pop_back();
+                        onStack[member] = false;
+                        graph.components[member] = component;
+                        size++;
+                    } while (member != node);
+                    graph.componentSizes.push_back(size);
+                }
+                if (!calls.empty())
+                {
+                    auto parent = calls.back().first;
+                    lowLinks[parent] = orxMIN(lowLinks[parent], lowLinks[node]);
+                }
+            }
+        }
+    }
+
+    // Components are sinks first, so every successor's row is final by the
+    // time it's merged into its predecessors'
+    void BuildClosure(Graph &graph)
+    {
+        auto componentCount = graph.componentSizes.size();
+        graph.rowWords = (graph.nodeCount + 63) / 64;
+        graph.closure.assign(componentCount * graph.rowWords, 0);
+
+        std::vector<std::vector<orxU32>> members(componentCount);
+        for (orxU32 node = 0; node < graph.nodeCount; node++)
+        {
+            auto component = graph.components[node];
+            members[component].push_back(node);
+            graph.closure[component * graph.rowWords + node / 64] |= (orxU64)1 << (node % 64);
+        }
+
+        std::vector<size_t> merged(componentCount, SIZE_MAX);
+        for (size_t component = 0; component < componentCount; component++)
+        {
+            auto row = &graph.closure[component * graph.rowWords];
+            for (auto node : members[component])
+            {
+                for (auto edge = graph.offsets[node]; edge < graph.offsets[node + 1]; edge++)
+                {
+                    auto successor = graph.components[graph.edges[edge].to];
+                    if (successor == component || merged[successor] == component)
+                        continue;
+                    merged[successor] = component;
+                    auto successorRow = &graph.closure[successor * graph.rowWords];
+                    for (size_t word = 0; word < graph.rowWords; word++)
+                        row[word] |= successorRow[word];
+                }
+            }
+        }
+    }
+
+    // Read the prefixes of a link destination into edge, returns the name
+    const orxSTRING ParseLink(const orxSTRING destination, Edge &edge)
+    {
+        edge = {orxU32_UNDEFINED, defaultPriority, false, false};
+        for (; *destination != orxCHAR_NULL; destination++)
+        {
+            if (*destination == '.')
+                edge.immediate = true;
+            else if (*destination == '!')
+                edge.clearTarget = true;
+            else if (*destination == '+')
+                edge.priority++;
+            else if (*destination == '-')
+                edge.priority--;
+            else
+                break;
+        }
+        return destination;
+    }
+
+    // Nodes are names, with their links under the matching linkSources key
+    // of the set's section
+    void Build(const orxSTRING animSetName, const std::vector<const orxCHAR *> &names, const std::vector<const orxCHAR *> &linkSources, Graph &graph)
+    {
+        auto start = orxSystem_GetTime();
+        graph.nodeCount = (orxU32)names.size();
+
+        std::unordered_map<std::string, orxU32> positions{};
+        for (orxU32 node = 0; node < graph.nodeCount; node++)
+            positions.emplace(names[node], node);
+        auto find = [&positions](const orxSTRING name)
+        {
+            auto found = positions.find(name);
+            return found != positions.end() ? found->second : orxU32_UNDEFINED;
+        };
+
+        orxConfig_PushSection(animSetName);
+        graph.offsets.push_back(0);
+        for (orxU32 node = 0; node < graph.nodeCount; node++)
+        {
+            auto linkSource = linkSources[node];
+            for (orxS32 i = 0, count = orxConfig_GetListCount(linkSource); i < count; i++)
+            {
+                Edge edge;
+                auto destination = ParseLink(orxConfig_GetListString(linkSource, i), edge);
+                edge.to = find(destination);
+                if (edge.to != orxU32_UNDEFINED)
+                    graph.edges.push_back(edge);
+                else
+                    graph.dangling.emplace_back(node, destination);
+            }
+            graph.offsets.push_back((orxU32)graph.edges.size());
+        }
+        auto startKey = orxConfig_HasValue("StartAnim") ? "StartAnim" : "StartAnimList";
+        for (orxS32 i = 0, count = orxConfig_GetListCount(startKey); i < count; i++)
+        {
+            auto node = find(orxConfig_GetListString(startKey, i));
+            if (node != orxU32_UNDEFINED)
+                graph.starts.push_back(node);
+        }
+        orxConfig_PopSection();
+
+        FindComponents(graph);
+        BuildClosure(graph);
+
+        // Shortest paths from any start animation
+        graph.depths.assign(graph.nodeCount, orxU32_UNDEFINED);
+        graph.parents.assign(graph.nodeCount, orxU32_UNDEFINED);
+        std::vector<orxU32> queue{};
+        for (auto node : graph.starts)
+        {
+            if (graph.depths[node] == orxU32_UNDEFINED)
+            {
+                graph.depths[node] = 0;
+                queue.push_back(node);
+            }
+        }
+        for (size_t q = 0; q < queue.size(); q++)
+        {
+            auto node = queue[q];
+            for (auto edge = graph.offsets[node]; edge < graph.offsets[node + 1]; edge++)
+            {
+                auto to = graph.edges[edge].to;
+                if (graph.depths[to] != orxU32_UNDEFINED)
+                    continue;
+                graph.depths[to] = graph.depths[node] + 1;
+                graph.parents[to] = node;
+                queue.push_back(to);
+            }
+        }
+
+        graph.deadEnds.assign(graph.nodeCount, true);
+        for (orxU32 node = 0; node < graph.nodeCount; node++)
+        {
+            for (auto edge = graph.offsets[node]; edge < graph.offsets[node + 1]; edge++)
+                if (graph.edges[edge].to != node)
+                    graph.deadEnds[node] = false;
+            graph.deadEndCount += graph.deadEnds[node];
+            graph.unreachableCount += !graph.IsReachable(node);
+        }
+
+        graph.buildTime = orxSystem_GetTime() - start;
+    }
+
+    void Build(const orxANIMSET *animSet, Graph &graph)
+    {
+        const auto &index = animset::GetIndex(animSet);
+        Build(orxAnimSet_GetName(animSet), index.names, index.linkSources, graph);
+    }
+
+    // Links only change through structural rebuilds, which re-create the
+    // set under a new GUID
+    const Graph &Get(const orxANIMSET *animSet)
+    {
+        auto guid = orxStructure_GetGUID(animSet);
+        auto [entry, created] = graphs.try_emplace(guid);
+        if (created)
+        {
+            for (auto other = graphs.begin(); other != graphs.end();)
+                other = other->first != guid ? graphs.erase(other) : std::next(other);
+            Build(animSet, entry->second);
+        }
+        return entry->second;
+    }
+}
+
+namespace reload
+{
+    // Config files are watched (WatchList = Config), so they can change
+    // behind the models, indices and graphs read from them
+    orxSTATUS orxFASTCALL EventHandler(const orxEVENT *event)
+    {
+        auto payload = (const orxRESOURCE_EVENT_PAYLOAD *)event->pstPayload;
+        if (payload->stGroupID == orxString_Hash(orxCONFIG_KZ_RESOURCE_GROUP))
+        {
+            model::Invalidate();
+            animset::InvalidateIndices();
+            graph::graphs.clear();
+        }
+        return orxSTATUS_SUCCESS;
+    }
+
+    void Init()
+    {
+        orxEvent_AddHandler(orxEVENT_TYPE_RESOURCE, EventHandler);
+        orxEvent_SetHandlerIDFlags(EventHandler, orxEVENT_TYPE_RESOURCE, orxNULL, orxEVENT_GET_FLAG(orxRESOURCE_EVENT_UPDATE), orxEVENT_KU32_MASK_ID_ALL);
+    }
+
+    void Exit()
+    {
+        orxEvent_RemoveHandler(orxEVENT_TYPE_RESOURCE, EventHandler);
+    }
+}
+
+namespace memory
+{
+    void Init()
+    {
+        orxConfig_PushSection("AnimTester");
+        showOverlay = orxConfig_GetBool("ShowStats");
+        assertSteady = orxConfig_GetBool("AssertNoFrameAllocations");
+        orxConfig_PopSection();
+        track = true;
+    }
+
+    // Close the app allocation count for the frame that just ended
+    void EndFrame()
+    {
+        lastFrameAllocationCount = frameAllocationCount;
+        lastFrameAllocationSize = frameAllocationSize;
+        frameAllocationCount = 0;
+        frameAllocationSize = 0;
+
+        // Window creation and buffer growth allocate during the first frames
+        const orxU32 warmupFrames = 60;
+        if (lastFrameSteady && steadyFrameCount++ >= warmupFrames && assertSteady)
+        {
+            orxASSERT(lastFrameAllocationCount == 0 && sstImGui.u32LastFrameAllocationCount == 0,
+                      "Steady UI frame allocated: %u app allocation(s), %u ImGui allocation(s)",
+                      lastFrameAllocationCount, sstImGui.u32LastFrameAllocationCount);
+        }
+    }
+
+    // Dear ImGui allocator benchmark: the UI runs with the demo window open
+    // for a warm-up phase, then for the same number of frames with each
+    // allocator while the time spent in the allocator is recorded
+    struct AllocatorResult
+    {
+        orxDOUBLE totalTime;
+        orxDOUBLE maxTime;
+        orxU32 allocationCount;
+        orxU32 frameCount;
+    };
+
+    const orxSTRING allocatorNames[orxIMGUI_ALLOCATOR_NUMBER] = {"System", "Tiered"};
+    AllocatorResult benchmarkResults[orxIMGUI_ALLOCATOR_NUMBER] = {};
+    orxU32 benchmarkFrames = 0;
+    orxU32 benchmarkFrame = 0;
+    orxU32 benchmarkPhase = 0;
+    orxIMGUI_ALLOCATOR configuredAllocator = orxIMGUI_ALLOCATOR_TIERED;
+
+    orxBOOL IsBenchmarking()
+    {
+        return benchmarkFrame < benchmarkFrames * (1 + orxIMGUI_ALLOCATOR_NUMBER);
+    }
+
+    void InitBenchmark()
+    {
+        orxConfig_PushSection("AnimTester");
+        benchmarkFrames = orxConfig_GetU32("AllocatorBenchmarkFrames");
+        orxConfig_PopSection();
+        configuredAllocator = sstImGui.eAllocator;
+        // Allocator time is only shown by the overlay and the benchmark
+        sstImGui.bTimeAllocator = showOverlay || benchmarkFrames > 0;
+    }
+
+    // Record the frame that just ended and pick the allocator for this one
+    void UpdateBenchmark()
+    {
+        if (!IsBenchmarking())
+            return;
+
+        // Phase 0 is the warm-up, then one phase per allocator
+        if (benchmarkPhase > 0)
+        {
+            auto &result = benchmarkResults[benchmarkPhase - 1];
+            result.totalTime += sstImGui.dLastFrameAllocatorTime;
+            result.maxTime = orxMAX(result.maxTime, sstImGui.dLastFrameAllocatorTime);
+            result.allocationCount += sstImGui.u32LastFrameAllocationCount;
+            result.frameCount++;
+        }
+
+        benchmarkFrame++;
+        benchmarkPhase = benchmarkFrame / benchmarkFrames;
+        if (IsBenchmarking())
+        {
+            sstImGui.eAllocator = benchmarkPhase > 0 ? (orxIMGUI_ALLOCATOR)(benchmarkPhase - 1) : configuredAllocator;
+        }
+        else
+        {
+            sstImGui.eAllocator = configuredAllocator;
+            for (orxU32 i = 0; i < orxIMGUI_ALLOCATOR_NUMBER; i++)
+            {
+                const auto &result = benchmarkResults[i];
+                orxLOG("ImGui %s allocator: %.3f us/frame average, %.3f us worst frame, %.2f allocations/frame over %u frames",
+                       allocatorNames[i], result.totalTime * 1e6 / result.frameCount, result.maxTime * 1e6,
+                       (orxFLOAT)result.allocationCount / result.frameCount, result.frameCount);
+            }
+        }
+    }
+
+    // Record whether the current frame is expected to be allocation free,
+    // changed tells if a rebuild or save was processed during the frame
+    void UpdateSteady(orxBOOL changed)
+    {
+        auto &io = ImGui::GetIO();
+        auto idle = io.MouseDelta.x == 0.0f && io.MouseDelta.y == 0.0f && io.MouseWheel == 0.0f && io.InputQueueCharacters.Size == 0 && !ImGui::IsAnyMouseDown() && !ImGui::IsAnyItemActive();
+        for (int i = 0; idle && i < IM_ARRAYSIZE(io.KeysDown); i++)
+            idle = !io.KeysDown[i];
+        lastFrameSteady = idle && !changed && !rebuild::IsPending() && !save.has_value();
+    }
+}
+
+namespace idle
+{
+    // Core clock tick size while idle, 0 to disable throttling
+    orxFLOAT idleTickSize = orxFLOAT_0;
+    // Seconds without activity before throttling
+    orxFLOAT idleDelay = orxFLOAT_0;
+
+    orxFLOAT activeTickSize = orxFLOAT_0;
+    orxDOUBLE lastActiveTime = orxDOUBLE_0;
+    orxBOOL idle = orxFALSE;
+
+    // Polls input at full rate while the core clock is throttled, so the
+    // first input after idling isn't held back by a slow tick
+    orxCLOCK *wakeClock = orxNULL;
+
+    void Wake()
+    {
+        lastActiveTime = orxSystem_GetTime();
+        if (idle)
+        {
+            idle = orxFALSE;
+            orxClock_SetTickSize(orxClock_Get(orxCLOCK_KZ_CORE), activeTickSize);
+            orxClock_Pause(wakeClock);
+        }
+    }
+
+    void orxFASTCALL PollInput(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+    {
+        if (orxImGui_HasPendingInput())
+        {
+            Wake();
+        }
+    }
+
+    void Init()
+    {
+        orxConfig_PushSection("AnimTester");
+        auto frequency = orxConfig_GetFloat("IdleFrequency");
+        idleTickSize = frequency > orxFLOAT_0 ? orxFLOAT_1 / frequency : orxFLOAT_0;
+        idleDelay = orxMAX(orxFLOAT_0, orxConfig_GetFloat("IdleDelay"));
+        auto wakeFrequency = orxConfig_GetFloat("WakeFrequency");
+        orxConfig_PopSection();
+
+        activeTickSize = orxClock_GetTickSize(orxClock_Get(orxCLOCK_KZ_CORE));
+        lastActiveTime = orxSystem_GetTime();
+
+        if (idleTickSize > orxFLOAT_0)
+        {
+            wakeClock = orxClock_Create(wakeFrequency > orxFLOAT_0 ? orxFLOAT_1 / wakeFrequency : orxFLOAT_0);
+            orxClock_Register(wakeClock, PollInput, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_NORMAL);
+            orxClock_Pause(wakeClock);
+        }
+    }
+
+    // Throttles the core clock once nothing has happened for a while,
+    // active tells if the current frame did any work
+    void Update(orxBOOL active)
+    {
+        if (idleTickSize <= orxFLOAT_0)
+            return;
+
+        if (active)
+        {
+            Wake();
+        }
+        else if (!idle && orxSystem_GetTime() - lastActiveTime >= idleDelay)
+        {
+            idle = orxTRUE;
+            orxClock_SetTickSize(orxClock_Get(orxCLOCK_KZ_CORE), idleTickSize);
+            orxClock_Unpause(wakeClock);
+        }
+    }
+
+    void Exit()
+    {
+        if (wakeClock != orxNULL)
+        {
+            orxClock_SetTickSize(orxClock_Get(orxCLOCK_KZ_CORE), activeTickSize);
+            orxClock_Delete(wakeClock);
+            wakeClock = orxNULL;
+        }
+    }
+}
+
+namespace stress
+{
+    // Spawns many copies of the edited object and measures the cost of
+    // updating and rendering them, configured by the Stress section
+    struct Result
+    {
+        orxU32 count = 0;
+        orxU32 frameCount = 0;
+        orxDOUBLE updateTime = orxDOUBLE_0;
+        orxDOUBLE renderTime = orxDOUBLE_0;
+        orxDOUBLE frameTime = orxDOUBLE_0;
+        orxDOUBLE maxFrameTime = orxDOUBLE_0;
+    };
+
+    std::vector<orxU32> counts{};
+    std::vector<Result> results{};
+    std::vector<orxOBJECT *> instances{};
+    orxU32 warmupFrames = 0;
+    orxU32 framesPerStep = 0;
+
+    orxBOOL running = orxFALSE;
+    size_t step = 0;
+    orxU32 stepFrame = 0;
+
+    // Timestamps for the frame being measured
+    orxDOUBLE updateStart = orxDOUBLE_0;
+    orxDOUBLE renderStart = orxDOUBLE_0;
+    orxDOUBLE frameStart = orxDOUBLE_0;
+    orxDOUBLE renderInUpdate = orxDOUBLE_0;
+
+    orxBOOL IsMeasuring()
+    {
+        return running && stepFrame > warmupFrames;
+    }
+
+    // Brackets all of the core clock's callbacks, object and anim updates included
+    void orxFASTCALL UpdateStart(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+    {
+        auto now = orxSystem_GetTime();
+        if (IsMeasuring() && frameStart > orxDOUBLE_0)
+        {
+            auto &result = results.back();
+            auto frameTime = now - frameStart;
+            result.frameTime += frameTime;
+            result.maxFrameTime = orxMAX(result.maxFrameTime, frameTime);
+            result.frameCount++;
+        }
+        frameStart = now;
+        updateStart = now;
+        renderInUpdate = orxDOUBLE_0;
+    }
+
+    void orxFASTCALL UpdateStop(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+    {
+        // Rendering is a core clock callback too, keep it out of the update time
+        if (IsMeasuring())
+            results.back().updateTime += orxSystem_GetTime() - updateStart - renderInUpdate;
+    }
+
+    orxSTATUS orxFASTCALL EventHandler(const orxEVENT *_pstEvent)
+    {
+        auto now = orxSystem_GetTime();
+        if (_pstEvent->eID == orxRENDER_EVENT_START)
+        {
+            renderStart = now;
+        }
+        else if (IsMeasuring())
+        {
+            results.back().renderTime += now - renderStart;
+            renderInUpdate += now - renderStart;
+        }
+        return orxSTATUS_SUCCESS;
+    }
+
+    void Despawn()
+    {
+        for (auto instance : instances)
+            orxObject_Delete(instance);
+        instances.clear();
+    }
+
+    // Lay count copies out on a square grid around the origin, each playing
+    // a random animation from a random time at a random frequency
+    void Spawn(orxU32 count)
+    {
+        Despawn();
+        instances.reserve(count);
+
+        orxConfig_PushSection("Stress");
+        orxVECTOR spacing;
+        orxConfig_GetVector("Spacing", &spacing);
+        auto columns = (orxU32)orxMath_Ceil(orxMath_Sqrt((orxFLOAT)count));
+        auto rows = (count + columns - 1) / columns;
+        for (orxU32 i = 0; i < count; i++)
+        {
+            auto instance = orxObject_CreateFromConfig(objectName);
+            if (instance == orxNULL)
+                break;
+            instances.push_back(instance);
+
+            orxVECTOR position;
+            orxVector_Set(&position, ((orxFLOAT)(i % columns) - 0.5f * (columns - 1)) * spacing.fX, ((orxFLOAT)(i / columns) - 0.5f * (rows - 1)) * spacing.fY, orxFLOAT_0);
+            orxObject_SetPosition(instance, &position);
+
+            auto animPointer = orxOBJECT_GET_STRUCTURE(instance, ANIMPOINTER);
+            if (animPointer == orxNULL)
+                continue;
+            auto animSet = orxAnimPointer_GetAnimSet(animPointer);
+            auto animCount = orxAnimSet_GetAnimCount(animSet);
+            if (animCount == 0)
+                continue;
+            auto animID = orxMath_GetRandomU32(0, animCount - 1);
+            orxAnimPointer_SetCurrentAnim(animPointer, animID);
+            orxAnimPointer_SetTime(animPointer, orxMath_GetRandomFloat(orxFLOAT_0, orxAnim_GetLength(orxAnimSet_GetAnim(animSet, animID))));
+            // Frequency can be a random range, eg. 0.5 ~ 2
+            orxAnimPointer_SetFrequency(animPointer, orxConfig_GetFloat("Frequency"));
+        }
+        orxConfig_PopSection();
+    }
+
+    void Init()
+    {
+        orxConfig_PushSection("Stress");
+        for (orxS32 i = 0, count = orxConfig_GetListCount("CountList"); i < count; i++)
+            counts.push_back(orxConfig_GetListU32("CountList", i));
+        warmupFrames = orxConfig_GetU32("WarmupFrames");
+        framesPerStep = orxMAX(1u, orxConfig_GetU32("FramesPerStep"));
+        auto autoStart = orxConfig_GetBool("AutoStart");
+        orxConfig_PopSection();
+
+        if (counts.empty())
+            return;
+
+        auto clock = orxClock_Get(orxCLOCK_KZ_CORE);
+        orxClock_Register(clock, UpdateStart, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_HIGHEST);
+        orxClock_Register(clock, UpdateStop, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_LOWEST);
+        orxEvent_AddHandler(orxEVENT_TYPE_RENDER, EventHandler);
+        orxEvent_SetHandlerIDFlags(EventHandler, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_GET_FLAG(orxRENDER_EVENT_START) | orxEVENT_GET_FLAG(orxRENDER_EVENT_STOP), orxEVENT_KU32_MASK_ID_ALL);
+
+        running = autoStart;
+    }
+
+    void Start()
+    {
+        results.clear();
+        step = 0;
+        stepFrame = 0;
+        running = orxTRUE;
+    }
+
+    void Stop()
+    {
+        Despawn();
+        running = orxFALSE;
+        orxObject_Enable(targetObject, orxTRUE);
+    }
+
+    // Advance through CountList, one step of warm-up and measured frames per count
+    void Update()
+    {
+        if (!running)
+            return;
+
+        if (stepFrame == 0)
+        {
+            // Keep the edited object out of the measurements
+            orxObject_Enable(targetObject, orxFALSE);
+            Spawn(counts[step]);
+            auto &result = results.emplace_back();
+            result.count = (orxU32)instances.size();
+        }
+
+        if (++stepFrame > warmupFrames + framesPerStep)
+        {
+            const auto &result = results.back();
+            auto frames = orxMAX(1u, result.frameCount);
+            orxLOG("Stress %u objects: update %.3f ms, render %.3f ms, frame %.3f ms (%.3f ms max) over %u frames",
+                   result.count, result.updateTime * 1e3 / frames, result.renderTime * 1e3 / frames,
+                   result.frameTime * 1e3 / frames, result.maxFrameTime * 1e3, result.frameCount);
+
+            stepFrame = 0;
+            if (++step >= counts.size())
+                Stop();
+        }
+    }
+
+    void Exit()
+    {
+        if (counts.empty())
+            return;
+        auto clock = orxClock_Get(orxCLOCK_KZ_CORE);
+        orxClock_Unregister(clock, UpdateStart);
+        orxClock_Unregister(clock, UpdateStop);
+        orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, EventHandler);
+        Despawn();
+    }
+}
+
+#ifdef __orxPROFILER__
+namespace profiler
+{
+    // Markers pushed by the app and the ImGui backend, sampled once per frame
+    const orxCHAR *markerNames[] = {
+        "Update",
+        "gui::ObjectWindow",
+        "gui::AnimSetWindow",
+        "gui::StatsWindow",
+        "config::Save",
+        "rebuild::Apply",
+        "orxImGui_BeginFrame",
+        "orxImGui_EndFrame",
+        "orxImGui_Draw",
+    };
+    const orxU32 markerCount = sizeof(markerNames) / sizeof(markerNames[0]);
+    const orxU32 historySize = 240;
+
+    struct Marker
+    {
+        orxS32 id = orxPROFILER_KS32_MARKER_ID_NONE;
+        orxU32 pushCount = 0;
+        // Milliseconds spent per frame, as a ring buffer
+        float history[historySize] = {};
+        float min = 0.0f;
+        float average = 0.0f;
+        float max = 0.0f;
+    };
+
+    Marker markers[markerCount]{};
+    orxU32 historyOffset = 0;
+    orxU32 historyCount = 0;
+
+    void Init()
+    {
+        for (orxU32 i = 0; i < markerCount; i++)
+            markers[i].id = orxProfiler_GetIDFromName(markerNames[i]);
+    }
+
+    // Record the last completed frame and refresh the rolling statistics
+    void Update()
+    {
+        orxProfiler_SelectQueryFrame(0, orxThread_GetCurrent());
+        for (auto &marker : markers)
+        {
+            auto valid = orxProfiler_IsMarkerIDValid(marker.id);
+            marker.pushCount = valid ? orxProfiler_GetMarkerPushCount(marker.id) : 0;
+            marker.history[historyOffset] = valid ? (float)(orxProfiler_GetMarkerTotalTime(marker.id) * 1e3) : 0.0f;
+        }
+        historyOffset = (historyOffset + 1) % historySize;
+        historyCount = orxMIN(historyCount + 1, historySize);
+
+        for (auto &marker : markers)
+        {
+            marker.min = marker.max = marker.history[0];
+            auto total = 0.0f;
+            for (orxU32 i = 0; i < historyCount; i++)
+            {
+                marker.min = orxMIN(marker.min, marker.history[i]);
+                marker.max = orxMAX(marker.max, marker.history[i]);
+                total += marker.history[i];
+            }
+            marker.average = total / historyCount;
+        }
+    }
+}
+#endif
+
+namespace validate
+{
+    // Headless checks over a directory of config files, run from main()
+    // with --validate <dir> [--report <file>] [--jobs <n>]. Config is read
+    // on the main thread, image headers and bounds are checked by workers.
+    const orxU32 defaultJobs = 8;
+    const orxU32 maxJobs = 12;
+
+    struct Issue
+    {
+        const orxCHAR *severity;
+        std::string anim;
+        std::string message;
+    };
+
+    struct Image
+    {
+        std::string name{};
+        std::string path{};
+        orxU32 width = 0;
+        orxU32 height = 0;
+        const orxCHAR *severity = orxNULL;
+        std::string error{};
+    };
+
+    // Everything the workers need about one animation, copied out of config
+    struct Anim
+    {
+        std::string name{};
+        // -1 for as many frames as fit, 0 for frames defined in config
+        orxS32 frameCount = -1;
+        size_t image = 0;
+        orxVECTOR frameSize{};
+        orxVECTOR textureOrigin{};
+        orxVECTOR textureSize{};
+    };
+
+    struct Set
+    {
+        std::string name{};
+        std::string origin{};
+        std::vector<Anim> anims{};
+        std::vector<Issue> issues{};
+    };
+
+    std::string directory{};
+    std::vector<std::string> files{};
+    std::vector<Image> images{};
+    std::vector<Set> sets{};
+
+    orxSTATUS orxFASTCALL Bootstrap()
+    {
+        orxResource_AddStorage(orxCONFIG_KZ_RESOURCE_GROUP, directory.c_str(), orxFALSE);
+        orxResource_AddStorage(orxTEXTURE_KZ_RESOURCE_GROUP, directory.c_str(), orxFALSE);
+
+        // Only the files under validation get loaded
+        return orxSTATUS_FAILURE;
+    }
+
+    // Run job(0..count-1) on the worker pool, the calling thread helps out
+    template <typename F>
+    struct Pool
+    {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        size_t count = 0;
+        F *job = nullptr;
+
+        orxBOOL Step()
+        {
+            auto i = next++;
+            if (i >= count)
+                return orxFALSE;
+            (*job)(i);
+            done++;
+            return orxTRUE;
+        }
+
+        static orxSTATUS orxFASTCALL Run(void *_pContext)
+        {
+            // orx keeps calling a thread's function until it fails
+            return ((Pool *)_pContext)->Step() ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+        }
+    };
+
+    template <typename F>
+    void Parallel(size_t count, orxU32 jobs, F job)
+    {
+        Pool<F> pool{};
+        pool.count = count;
+        pool.job = &job;
+
+        std::vector<orxU32> threads{};
+        for (orxU32 i = 0; i < jobs && i < count; i++)
+        {
+            auto thread = orxThread_Start(decltype(pool)::Run, "Validate", &pool);
+            if (thread == orxU32_UNDEFINED)
+                break;
+            threads.push_back(thread);
+        }
+
+        while (pool.Step())
+            ;
+        // Joining stops a thread, so wait for its last job to finish first
+        while (pool.done < count)
+            orxSystem_Delay(0.001f);
+        for (auto thread : threads)
+            orxThread_Join(thread);
+    }
+
+    // Collect config files, directories are walked recursively
+    void FindFiles(const std::string &subDirectory)
+    {
+        orxFILE_INFO info;
+        auto pattern = directory + "/" + subDirectory + "*";
+        for (auto found = orxFile_FindFirst(pattern.c_str(), &info); found; found = orxFile_FindNext(&info))
+        {
+            std::string name = info.zName;
+            if (name == "." || name == "..")
+                continue;
+            if (info.u32Flags & orxFILE_KU32_FLAG_INFO_DIRECTORY)
+            {
+                FindFiles(subDirectory + name + "/");
+            }
+            else if (name.size() > 4 && orxString_ICompare(name.c_str() + name.size() - 4, ".ini") == 0)
+            {
+                files.push_back(subDirectory + name);
+            }
+        }
+        orxFile_FindClose(&info);
+    }
+
+    // Files defining each section. Everything is loaded into one config, so
+    // a section found in several files is merged and only checked once.
+    std::map<std::string, std::vector<std::string>> definitions{};
+
+    void FindSections(const std::string &file)
+    {
+        auto handle = std::fopen((directory + "/" + file).c_str(), "rb");
+        if (handle == nullptr)
+            return;
+        orxCHAR line[1024];
+        while (std::fgets(line, sizeof(line), handle) != nullptr)
+        {
+            auto start = line;
+            while (*start == ' ' || *start == '\t' || *start == '!')
+                start++;
+            if (*start != '[')
+                continue;
+            auto end = std::strpbrk(start + 1, "@]");
+            if (end == nullptr)
+                continue;
+            auto &files = definitions[std::string(start + 1, end)];
+            if (files.empty() || files.back() != file)
+                files.push_back(file);
+        }
+        std::fclose(handle);
+    }
+
+    std::map<std::string, size_t, std::less<>> imageIndices{};
+
+    size_t GetImage(const orxSTRING texture)
+    {
+        auto [it, inserted] = imageIndices.try_emplace(texture, images.size());
+        if (!inserted)
+            return it->second;
+        auto &image = images.emplace_back();
+        image.name = texture;
+        auto location = orxResource_Locate(orxTEXTURE_KZ_RESOURCE_GROUP, texture);
+        if (location != orxNULL)
+        {
+            image.path = orxResource_GetPath(location);
+        }
+        else
+        {
+            image.severity = "error";
+            image.error = "texture not found";
+        }
+        return it->second;
+    }
+
+    // Look a property up in the animation section, then in the set, the
+    // same way orx parents animation sections to their set at runtime
+    orxBOOL GetVector(const orxSTRING section, const orxSTRING setName, const orxSTRING key, orxVECTOR &out)
+    {
+        for (auto name : {section, setName})
+        {
+            if (name == orxNULL || !orxConfig_HasSection(name))
+                continue;
+            orxConfig_PushSection(name);
+            auto found = orxConfig_HasValue(key);
+            if (found)
+                orxConfig_GetVector(key, &out);
+            orxConfig_PopSection();
+            if (found)
+                return orxTRUE;
+        }
+        return orxFALSE;
+    }
+
+    const orxSTRING GetString(const orxSTRING section, const orxSTRING setName, const orxSTRING key)
+    {
+        if (section != orxNULL && orxConfig_HasSection(section))
+        {
+            orxConfig_PushSection(section);
+            auto found = orxConfig_HasValue(key);
+            auto value = orxConfig_GetString(key);
+            orxConfig_PopSection();
+            if (found)
+                return value;
+        }
+        orxConfig_PushSection(setName);
+        auto value = orxConfig_GetString(key);
+        orxConfig_PopSection();
+        return value;
+    }
+
+    // Walk the animation graph from its entry points, the way orx builds a
+    // set, and copy out what's needed to check each animation
+    void ExtractSet(const orxSTRING setName)
+    {
+        auto &set = sets.emplace_back();
+        set.name = setName;
+        set.origin = orxConfig_GetOrigin(setName);
+
+        orxConfig_PushSection(setName);
+        std::string prefix = orxConfig_GetString("Prefix");
+        std::vector<std::pair<std::string, std::string>> queue{};
+        auto startKey = orxConfig_HasValue("StartAnim") ? "StartAnim" : "StartAnimList";
+        for (orxS32 i = 0, count = orxConfig_GetListCount(startKey); i < count; i++)
+            queue.emplace_back(orxConfig_GetListString(startKey, i), startKey);
+
+        // Link sources must be animations of the set too
+        for (orxU32 i = 0, count = orxConfig_GetKeyCount(); i < count; i++)
+        {
+            std::string key = orxConfig_GetKey(i);
+            if (key.size() > 2 && key.compare(key.size() - 2, 2, "->") == 0)
+            {
+                auto source = key.substr(0, key.size() - 2);
+                if (!orxConfig_HasValue(source.c_str()) && !orxConfig_HasSection((prefix + source).c_str()))
+                    set.issues.push_back({"error", source, "links from an undefined animation"});
+            }
+        }
+        orxConfig_PopSection();
+
+        std::set<std::string> visited{};
+        for (size_t q = 0; q < queue.size(); q++)
+        {
+            auto [name, referrer] = queue[q];
+            if (!visited.insert(name).second)
+                continue;
+
+            orxConfig_PushSection(setName);
+            auto defined = orxConfig_HasValue(name.c_str());
+            auto templateName = name;
+            orxS32 frameCount = -1;
+            orxBOOL frameFiles = orxFALSE;
+            auto valueCount = defined ? orxConfig_GetListCount(name.c_str()) : 0;
+            if (valueCount > 0)
+            {
+                // Animation = [Template] # [Count], or a single count
+                auto first = orxConfig_GetListString(name.c_str(), 0);
+                orxS32 value;
+                if (valueCount == 1 && orxString_ToS32(first, &value, orxNULL) == orxSTATUS_SUCCESS)
+                {
+                    frameCount = value;
+                }
+                else if (valueCount == 1 && orxString_ICompare(first, "empty") == 0)
+                {
+                    frameCount = 0;
+                    frameFiles = orxTRUE;
+                }
+                else
+                {
+                    templateName = first;
+                    if (valueCount > 1)
+                    {
+                        if (orxString_ToS32(orxConfig_GetListString(name.c_str(), 1), &value, orxNULL) == orxSTATUS_SUCCESS)
+                            frameCount = value;
+                        else
+                            frameFiles = orxTRUE;
+                    }
+                }
+            }
+
+            auto link = config::GetAnimLinkSource(name.c_str());
+            for (orxS32 i = 0, count = orxConfig_GetListCount(link); i < count; i++)
+            {
+                auto destination = orxConfig_GetListString(link, i);
+                while (*destination == '.' || *destination == '!' || *destination == '+' || *destination == '-')
+                    destination++;
+                queue.emplace_back(destination, name + "->");
+            }
+            orxConfig_PopSection();
+
+            auto section = prefix + templateName;
+            auto hasSection = orxConfig_HasSection(section.c_str());
+            if (!defined && !hasSection)
+            {
+                set.issues.push_back({"error", name, "dangling reference from " + referrer});
+                continue;
+            }
+            if (!hasSection)
+            {
+                if (frameCount == 0 && !frameFiles)
+                    set.issues.push_back({"error", name, "frames are defined in config but section " + section + " is missing"});
+                else
+                    set.issues.push_back({"warning", name, "section " + section + " is missing, set defaults are used"});
+            }
+
+            // Text, empty and file-per-frame animations have no sheet to check
+            auto texture = GetString(section.c_str(), setName, "Texture");
+            if (frameFiles || frameCount == 0 || *texture == orxCHAR_NULL)
+                continue;
+
+            auto &anim = set.anims.emplace_back();
+            anim.name = name;
+            anim.frameCount = frameCount;
+            anim.image = GetImage(texture);
+            GetVector(section.c_str(), setName, "TextureOrigin", anim.textureOrigin);
+            GetVector(section.c_str(), setName, "TextureSize", anim.textureSize);
+            if (!GetVector(section.c_str(), setName, "FrameSize", anim.frameSize))
+                anim.frameSize = anim.textureSize;
+        }
+    }
+
+    // PNG stores its size in the IHDR chunk, right after the signature
+    void ReadImageSize(Image &image)
+    {
+        if (image.severity != orxNULL)
+            return;
+        auto file = std::fopen(image.path.c_str(), "rb");
+        if (file == nullptr)
+        {
+            image.severity = "error";
+            image.error = "can't open " + image.path;
+            return;
+        }
+        unsigned char header[24];
+        auto size = std::fread(header, 1, sizeof(header), file);
+        std::fclose(file);
+        const unsigned char signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+        if (size != sizeof(header) || orxMemory_Compare(header, signature, sizeof(signature)) != 0 || orxMemory_Compare(header + 12, "IHDR", 4) != 0)
+        {
+            image.severity = "warning";
+            image.error = "not a PNG file, bounds not checked";
+            return;
+        }
+        auto readU32 = [](const unsigned char *p)
+        { return ((orxU32)p[0] << 24) | ((orxU32)p[1] << 16) | ((orxU32)p[2] << 8) | (orxU32)p[3]; };
+        image.width = readU32(header + 16);
+        image.height = readU32(header + 20);
+    }
+
+    void CheckBounds(Set &set)
+    {
+        for (const auto &anim : set.anims)
+        {
+            const auto &image = images[anim.image];
+            if (image.severity != orxNULL)
+            {
+                set.issues.push_back({image.severity, anim.name, image.name + ": " + image.error});
+                continue;
+            }
+
+            // Frames are read from the TextureOrigin/TextureSize region,
+            // which defaults to the rest of the texture
+            auto regionWidth = anim.textureSize.fX > orxFLOAT_0 ? anim.textureSize.fX : image.width - anim.textureOrigin.fX;
+            auto regionHeight = anim.textureSize.fY > orxFLOAT_0 ? anim.textureSize.fY : image.height - anim.textureOrigin.fY;
+            if (anim.textureOrigin.fX < orxFLOAT_0 || anim.textureOrigin.fY < orxFLOAT_0 ||
+                anim.textureOrigin.fX + regionWidth > image.width || anim.textureOrigin.fY + regionHeight > image.height)
+            {
+                orxCHAR message[256];
+                orxString_NPrint(message, sizeof(message), "region (%g, %g) + (%g, %g) exceeds %s (%u x %u)",
+                                 anim.textureOrigin.fX, anim.textureOrigin.fY, regionWidth, regionHeight, image.name.c_str(), image.width, image.height);
+                set.issues.push_back({"error", anim.name, message});
+                continue;
+            }
+
+            // Capacity doesn't depend on Direction, only on the grid size
+            auto frameWidth = anim.frameSize.fX > orxFLOAT_0 ? anim.frameSize.fX : regionWidth;
+            auto frameHeight = anim.frameSize.fY > orxFLOAT_0 ? anim.frameSize.fY : regionHeight;
+            auto capacity = (orxS32)(regionWidth / frameWidth) * (orxS32)(regionHeight / frameHeight);
+            if (capacity == 0 || anim.frameCount > capacity)
+            {
+                orxCHAR message[256];
+                orxString_NPrint(message, sizeof(message), "%d frames requested but only %d frames of (%g, %g) fit in (%g, %g)",
+                                 anim.frameCount, capacity, frameWidth, frameHeight, regionWidth, regionHeight);
+                set.issues.push_back({"error", anim.name, message});
+            }
+        }
+    }
+
+    void AppendString(std::string &out, const std::string &value)
+    {
+        out += '"';
+        for (auto c : value)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out += '\\';
+                out += c;
+            }
+            else if ((unsigned char)c < 0x20)
+            {
+                orxCHAR escaped[8];
+                orxString_NPrint(escaped, sizeof(escaped), "\\u%04x", c);
+                out += escaped;
+            }
+            else
+            {
+                out += c;
+            }
+        }
+        out += '"';
+    }
+
+    // Write the JSON report and return the error count
+    orxU32 Report(const orxSTRING reportPath)
+    {
+        orxU32 errors = 0, warnings = 0;
+        std::string issues{};
+        auto append = [&](const orxSTRING severity, const std::string &set, const std::string &anim, const std::string &origin, const std::string &message)
+        {
+            (orxString_Compare(severity, "error") == 0 ? errors : warnings)++;
+            issues += issues.empty() ? "\n    {" : ",\n    {";
+            issues += "\"severity\": ";
+            AppendString(issues, severity);
+            issues += ", \"set\": ";
+            AppendString(issues, set);
+            issues += ", \"animation\": ";
+            AppendString(issues, anim);
+            issues += ", \"origin\": ";
+            AppendString(issues, origin);
+            issues += ", \"message\": ";
+            AppendString(issues, message);
+            issues += "}";
+        };
+        for (const auto &set : sets)
+        {
+            for (const auto &issue : set.issues)
+                append(issue.severity, set.name, issue.anim, set.origin, issue.message);
+        }
+        for (const auto &[section, definingFiles] : definitions)
+        {
+            if (definingFiles.size() < 2)
+                continue;
+            std::string message = "Section " + section + " is defined in";
+            for (const auto &file : definingFiles)
+                message += " " + file;
+            message += ", the definitions are merged and only checked together";
+            auto isSet = std::any_of(sets.begin(), sets.end(), [&section](const Set &set)
+                                     { return set.name == section; });
+            append("warning", isSet ? section : std::string{}, {}, definingFiles.back(), message);
+        }
+
+        orxCHAR counts[256];
+        orxString_NPrint(counts, sizeof(counts), "  \"files\": %u,\n  \"sets\": %u,\n  \"images\": %u,\n  \"errors\": %u,\n  \"warnings\": %u,\n",
+                         (orxU32)files.size(), (orxU32)sets.size(), (orxU32)images.size(), errors, warnings);
+        std::string out = "{\n  \"directory\": ";
+        AppendString(out, directory);
+        out += ",\n";
+        out += counts;
+        out += "  \"issues\": [";
+        out += issues;
+        out += issues.empty() ? "]\n}\n" : "\n  ]\n}\n";
+
+        auto file = reportPath != orxNULL ? std::fopen(reportPath, "wb") : stdout;
+        if (file == nullptr)
+        {
+            std::fprintf(stderr, "Can't write report to %s\n", reportPath);
+            return errors + 1;
+        }
+        std::fwrite(out.data(), 1, out.size(), file);
+        if (file != stdout)
+            std::fclose(file);
+        return errors;
+    }
+
+    int Main(int argc, char **argv)
+    {
+        const orxSTRING reportPath = orxNULL;
+        orxU32 jobs = defaultJobs;
+        for (int i = 1; i + 1 < argc; i++)
+        {
+            if (orxString_Compare(argv[i], "--validate") == 0)
+                directory = argv[++i];
+            else if (orxString_Compare(argv[i], "--report") == 0)
+                reportPath = argv[++i];
+            else if (orxString_Compare(argv[i], "--jobs") == 0)
+                orxString_ToU32(argv[++i], &jobs, orxNULL);
+        }
+        if (directory.empty())
+        {
+            std::fprintf(stderr, "Usage: %s --validate <directory> [--report <file>] [--jobs <count>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+        while (directory.size() > 1 && (directory.back() == '/' || directory.back() == '\\'))
+            directory.pop_back();
+        jobs = orxMIN(jobs, maxJobs);
+
+        // Config and threads only: no display, no ImGui
+        orxDEBUG_INIT();
+        orxModule_RegisterAll();
+        orxConfig_SetBootstrap(Bootstrap);
+        if (orxModule_Init(orxMODULE_ID_CONFIG) == orxSTATUS_FAILURE || orxModule_Init(orxMODULE_ID_FILE) == orxSTATUS_FAILURE ||
+            orxModule_Init(orxMODULE_ID_THREAD) == orxSTATUS_FAILURE)
+        {
+            std::fprintf(stderr, "Can't initialize orx\n");
+            orxModule_ExitAll();
+            orxDEBUG_EXIT();
+            return EXIT_FAILURE;
+        }
+
+        FindFiles("");
+        std::sort(files.begin(), files.end());
+        for (const auto &file : files)
+        {
+            FindSections(file);
+            orxConfig_Load(file.c_str());
+        }
+        // Pick up [Resource] storages declared by the loaded files
+        orxResource_ReloadStorage();
+
+        for (orxU32 i = 0, count = orxConfig_GetSectionCount(); i < count; i++)
+        {
+            auto section = orxConfig_GetSection(i);
+            orxConfig_PushSection(section);
+            auto isSet = orxConfig_HasValue("StartAnim") || orxConfig_HasValue("StartAnimList");
+            orxConfig_PopSection();
+            if (isSet)
+                ExtractSet(section);
+        }
+
+        Parallel(images.size(), jobs, [](size_t i)
+                 { ReadImageSize(images[i]); });
+        Parallel(sets.size(), jobs, [](size_t i)
+                 { CheckBounds(sets[i]); });
+
+        auto errors = Report(reportPath);
+
+        orxModule_ExitAll();
+        orxDEBUG_EXIT();
+        return errors > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+}
+
+namespace soak
+{
+    // Random walk over the links of the edited object's animation set, run
+    // from main() with --soak <requests> [--report <file>]. Only config is
+    // loaded, like --validate: orx's link rules are played over graph::Graph
+    // on simulated time, so no display is needed and time runs as fast as
+    // the steps allow. Tuned by the Soak config section.
+    //
+    // The rules followed: with a target, the highest priority link on a
+    // shortest route is taken, at once when immediate and once the current
+    // animation ends otherwise. Without one, the highest priority link is
+    // taken when the animation ends, and an animation without links stays
+    // on its last key. Reaching the target or taking a ! link clears it.
+    const orxU32 barWidth = 40;
+
+    struct Stats
+    {
+        // By node of the graph
+        std::vector<orxDOUBLE> times{};
+        std::vector<orxU64> starts{};
+        // Keyed by (source << 32) | destination
+        std::unordered_map<orxU64, orxU64> transitions{};
+        std::map<std::pair<orxU32, orxU32>, orxU32> unresolved{};
+        orxU64 requests = 0;
+        orxU64 resolved = 0;
+        orxU64 steps = 0;
+        orxDOUBLE simulatedTime = 0.0;
+        orxDOUBLE runTime = 0.0;
+    };
+
+    Stats stats{};
+    const orxCHAR *animSetName = orxNULL;
+    // Interned, sorted like animset::Index
+    std::vector<const orxCHAR *> names{};
+    std::vector<const orxCHAR *> linkSources{};
+    graph::Graph graph{};
+
+    // Simulated animation pointer
+    struct Pointer
+    {
+        // Seconds per loop, by node
+        std::vector<orxFLOAT> durations{};
+        // Incoming edges of node i are edges[inEdges[inOffsets[i]]] up to
+        // inOffsets[i + 1], to find routes to a target backwards
+        std::vector<orxU32> inOffsets{};
+        std::vector<orxU32> inEdges{};
+        std::vector<orxU32> sources{};
+        // Links left to the target, by node
+        std::vector<orxU32> distances{};
+        orxU32 current = orxU32_UNDEFINED;
+        orxU32 target = orxU32_UNDEFINED;
+        orxFLOAT time = orxFLOAT_0;
+    };
+
+    // The editor's config whatever the executable's suffix, as the bench does
+    orxSTATUS orxFASTCALL Bootstrap()
+    {
+        ::Bootstrap();
+        orxConfig_Load("animtester.ini");
+        return orxSTATUS_FAILURE;
+    }
+
+    // Animations orx would create for the set: its start animations and
+    // every link destination from there on
+    void FindAnims()
+    {
+        orxConfig_PushSection(animSetName);
+        auto startKey = orxConfig_HasValue("StartAnim") ? "StartAnim" : "StartAnimList";
+        for (orxS32 i = 0, count = orxConfig_GetListCount(startKey); i < count; i++)
+            names.push_back(orxString_Store(orxConfig_GetListString(startKey, i)));
+        for (size_t q = 0; q < names.size(); q++)
+        {
+            auto linkSource = config::GetAnimLinkSource(names[q]);
+            for (orxS32 i = 0, count = orxConfig_GetListCount(linkSource); i < count; i++)
+            {
+                graph::Edge edge;
+                auto destination = orxString_Store(graph::ParseLink(orxConfig_GetListString(linkSource, i), edge));
+                if (std::find(names.begin(), names.end(), destination) == names.end())
+                    names.push_back(destination);
+            }
+        }
+        orxConfig_PopSection();
+
+        std::sort(names.begin(), names.end(), [](auto a, auto b)
+                  { return orxString_Compare(a, b) < 0; });
+        for (auto name : names)
+            linkSources.push_back(config::GetAnimLinkSource(name));
+    }
+
+    // KeyDuration of the animation section, else the set, per key unless a
+    // key section has its own
+    orxFLOAT GetDuration(const orxCHAR *name)
+    {
+        auto section = config::GetAnimSectionName(animSetName, name);
+        orxConfig_PushSection(section);
+        auto owned = orxConfig_HasValue("KeyDuration");
+        if (!owned)
+        {
+            orxConfig_PopSection();
+            orxConfig_PushSection(animSetName);
+        }
+        auto keyDuration = orxConfig_GetFloat("KeyDuration");
+        orxConfig_PopSection();
+
+        auto duration = orxFLOAT_0;
+        for (orxS32 i = 1, frames = config::GetAnimFrames(animSetName, name); i <= frames; i++)
+        {
+            auto keySection = config::GetKeySectionName(section, i);
+            auto value = keyDuration;
+            if (orxConfig_HasSection(keySection))
+            {
+                orxConfig_PushSection(keySection);
+                if (orxConfig_HasValue("KeyDuration") && !orxConfig_IsInheritedValue("KeyDuration"))
+                    value = orxConfig_GetFloat("KeyDuration");
+                orxConfig_PopSection();
+            }
+            duration += value;
+        }
+        return duration;
+    }
+
+    void InitPointer(Pointer &pointer)
+    {
+        for (auto name : names)
+            pointer.durations.push_back(GetDuration(name));
+
+        pointer.inOffsets.assign(graph.nodeCount + 1, 0);
+        pointer.sources.resize(graph.edges.size());
+        for (orxU32 node = 0; node < graph.nodeCount; node++)
+        {
+            for (auto edge = graph.offsets[node]; edge < graph.offsets[node + 1]; edge++)
+            {
+                pointer.sources[edge] = node;
+                pointer.inOffsets[graph.edges[edge].to + 1]++;
+            }
+        }
+        for (orxU32 node = 0; node < graph.nodeCount; node++)
+            pointer.inOffsets[node + 1] += pointer.inOffsets[node];
+        pointer.inEdges.resize(graph.edges.size());
+        auto fill = pointer.inOffsets;
+        for (orxU32 edge = 0; edge < (orxU32)graph.edges.size(); edge++)
+            pointer.inEdges[fill[graph.edges[edge].to]++] = edge;
+
+        pointer.current = graph.starts.front();
+    }
+
+    void SetTarget(Pointer &pointer, orxU32 target)
+    {
+        pointer.target = target;
+        pointer.distances.assign(graph.nodeCount, orxU32_UNDEFINED);
+        pointer.distances[target] = 0;
+        std::vector<orxU32> queue{target};
+        for (size_t q = 0; q < queue.size(); q++)
+        {
+            auto node = queue[q];
+            for (auto in = pointer.inOffsets[node]; in < pointer.inOffsets[node + 1]; in++)
+            {
+                auto source = pointer.sources[pointer.inEdges[in]];
+                if (pointer.distances[source] != orxU32_UNDEFINED)
+                    continue;
+                pointer.distances[source] = pointer.distances[node] + 1;
+                queue.push_back(source);
+            }
+        }
+    }
+
+    // Link the pointer takes next from its current animation, if any
+    orxU32 GetNextLink(const Pointer &pointer, bool &routing)
+    {
+        auto node = pointer.current;
+        routing = pointer.target != orxU32_UNDEFINED && pointer.distances[node] != orxU32_UNDEFINED;
+        auto next = orxU32_UNDEFINED;
+        for (auto edge = graph.offsets[node]; edge < graph.offsets[node + 1]; edge++)
+        {
+            if (routing && pointer.distances[graph.edges[edge].to] + 1 != pointer.distances[node])
+                continue;
+            if (next == orxU32_UNDEFINED || graph.edges[edge].priority > graph.edges[next].priority)
+                next = edge;
+        }
+        return next;
+    }
+
+    void Step(Pointer &pointer, orxFLOAT timeStep)
+    {
+        stats.times[pointer.current] += timeStep;
+        stats.simulatedTime += timeStep;
+        stats.steps++;
+        pointer.time += timeStep;
+
+        // Bounded, so chains of empty animations can't spin forever
+        for (orxU32 hop = 0; hop <= graph.nodeCount; hop++)
+        {
+            bool routing;
+            auto next = GetNextLink(pointer, routing);
+            auto duration = pointer.durations[pointer.current];
+            if (next == orxU32_UNDEFINED)
+            {
+                pointer.time = orxMIN(pointer.time, duration);
+                break;
+            }
+            const auto &link = graph.edges[next];
+            if (routing && link.immediate)
+                pointer.time = orxFLOAT_0;
+            else if (pointer.time >= duration)
+                pointer.time -= duration;
+            else
+                break;
+
+            // Looping on itself isn't a new start
+            if (link.to != pointer.current)
+            {
+                stats.starts[link.to]++;
+                stats.transitions[((orxU64)pointer.current << 32) | link.to]++;
+            }
+            pointer.current = link.to;
+            if (link.clearTarget || pointer.current == pointer.target)
+                pointer.target = orxU32_UNDEFINED;
+        }
+    }
+
+    void AppendBar(std::string &out, orxDOUBLE fraction)
+    {
+        out.append((size_t)orxMath_Round(fraction * barWidth), '#');
+    }
+
+    // Write the histogram report and return the unresolved request count
+    orxU64 Report(const orxSTRING reportPath)
+    {
+        size_t nameWidth = 0;
+        for (auto name : names)
+            nameWidth = orxMAX(nameWidth, (size_t)orxString_GetLength(name));
+
+        orxCHAR line[512];
+        std::string out{};
+        orxString_NPrint(line, sizeof(line), "Soak test of %s: %llu requests, %llu resolved, %llu steps, %.0f s simulated in %.2f s\n",
+                         animSetName, (unsigned long long)stats.requests, (unsigned long long)stats.resolved,
+                         (unsigned long long)stats.steps, stats.simulatedTime, stats.runTime);
+        out += line;
+
+        out += "\nTime per animation\n";
+        for (size_t node = 0; node < names.size(); node++)
+        {
+            auto fraction = stats.simulatedTime > 0.0 ? stats.times[node] / stats.simulatedTime : 0.0;
+            orxString_NPrint(line, sizeof(line), "  %-*s %6.2f%% %10llu starts  ", (int)nameWidth, names[node], fraction * 100.0,
+                             (unsigned long long)stats.starts[node]);
+            out += line;
+            AppendBar(out, fraction);
+            out += '\n';
+        }
+
+        // Most frequent first
+        std::vector<std::pair<orxU64, orxU64>> transitions(stats.transitions.begin(), stats.transitions.end());
+        std::sort(transitions.begin(), transitions.end(), [](const auto &a, const auto &b)
+                  { return a.second != b.second ? a.second > b.second : a.first < b.first; });
+        out += "\nTransitions\n";
+        for (const auto &[key, count] : transitions)
+        {
+            orxString_NPrint(line, sizeof(line), "  %-*s > %-*s %10llu  ", (int)nameWidth, names[key >> 32], (int)nameWidth,
+                             names[key & 0xFFFFFFFF], (unsigned long long)count);
+            out += line;
+            AppendBar(out, (orxDOUBLE)count / transitions.front().second);
+            out += '\n';
+        }
+
+        orxU64 unresolved = 0;
+        if (!stats.unresolved.empty())
+        {
+            out += "\nUnresolved requests\n";
+            for (const auto &[request, count] : stats.unresolved)
+            {
+                auto [from, to] = request;
+                orxString_NPrint(line, sizeof(line), "  %-*s > %-*s %10u  %s\n", (int)nameWidth, names[from], (int)nameWidth, names[to], count,
+                                 graph.CanReach(from, to) ? "timed out" : "no path in the link graph");
+                out += line;
+                unresolved += count;
+            }
+        }
+
+        auto file = reportPath != orxNULL ? std::fopen(reportPath, "wb") : stdout;
+        if (file == nullptr)
+        {
+            std::fprintf(stderr, "Can't write report to %s\n", reportPath);
+            return unresolved + 1;
+        }
+        std::fwrite(out.data(), 1, out.size(), file);
+        if (file != stdout)
+            std::fclose(file);
+        return unresolved;
+    }
+
+
+    // Request random targets, stepping time until each is reached or times out
+    void Walk(orxU64 requestCount)
+    {
+        Pointer pointer{};
+        InitPointer(pointer);
+        stats.times.assign(graph.nodeCount, 0.0);
+        stats.starts.assign(graph.nodeCount, 0);
+
+        orxConfig_PushSection("Soak");
+        orxMath_InitRandom(orxConfig_GetU32("Seed"));
+        auto timeStep = orxMAX(orxConfig_GetFloat("TimeStep"), 0.001f);
+        auto timeout = orxConfig_GetFloat("Timeout");
+
+        auto start = orxSystem_GetTime();
+        for (orxU64 request = 0; request < requestCount; request++)
+        {
+            auto from = pointer.current;
+            auto to = orxMath_GetRandomU32(0, graph.nodeCount - 1);
+            stats.requests++;
+            if (!graph.CanReach(from, to))
+            {
+                stats.unresolved[{from, to}]++;
+                continue;
+            }
+
+            if (to != from)
+                SetTarget(pointer, to);
+            orxFLOAT waited = orxFLOAT_0;
+            for (; pointer.current != to && waited < timeout; waited += timeStep)
+                Step(pointer, timeStep);
+            pointer.target = orxU32_UNDEFINED;
+            if (pointer.current != to)
+            {
+                stats.unresolved[{from, to}]++;
+                continue;
+            }
+            stats.resolved++;
+
+            // Linger on the target so its own links get exercised, Dwell can be a random range
+            for (auto dwell = orxConfig_GetFloat("Dwell"); dwell > orxFLOAT_0; dwell -= timeStep)
+                Step(pointer, timeStep);
+        }
+        orxConfig_PopSection();
+
+        stats.runTime = orxSystem_GetTime() - start;
+    }
+
+    int Main(int argc, char **argv)
+    {
+        const orxSTRING reportPath = orxNULL;
+        orxU64 requestCount = 0;
+        for (int i = 1; i + 1 < argc; i++)
+        {
+            if (orxString_Compare(argv[i], "--soak") == 0)
+                orxString_ToU64(argv[++i], &requestCount, orxNULL);
+            else if (orxString_Compare(argv[i], "--report") == 0)
+                reportPath = argv[++i];
+        }
+        if (requestCount == 0)
+        {
+            std::fprintf(stderr, "Usage: %s --soak <requests> [--report <file>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        // Config only: no display, no clock, nothing is created
+        orxDEBUG_INIT();
+        orxModule_RegisterAll();
+        orxConfig_SetBootstrap(Bootstrap);
+        if (orxModule_Init(orxMODULE_ID_CONFIG) == orxSTATUS_FAILURE)
+        {
+            std::fprintf(stderr, "Can't initialize orx\n");
+            orxModule_ExitAll();
+            orxDEBUG_EXIT();
+            return EXIT_FAILURE;
+        }
+
+        orxConfig_PushSection(objectName);
+        animSetName = orxString_Store(orxConfig_GetString("AnimationSet"));
+        orxConfig_PopSection();
+        if (orxConfig_HasSection(animSetName))
+        {
+            FindAnims();
+            graph::Build(animSetName, names, linkSources, graph);
+        }
+        if (graph.starts.empty())
+        {
+            std::fprintf(stderr, "%s has no animations to soak\n", objectName);
+            orxModule_ExitAll();
+            orxDEBUG_EXIT();
+            return EXIT_FAILURE;
+        }
+
+        Walk(requestCount);
+        auto unresolved = Report(reportPath);
+
+        orxModule_ExitAll();
+        orxDEBUG_EXIT();
+        return unresolved > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+}
+
+namespace pixels
+{
+    // Texture pixels read back from the display as packed RGBA words
+    struct Sheet
+    {
+        const orxBITMAP *bitmap = orxNULL;
+        orxU32 width = 0;
+        orxU32 height = 0;
+        std::vector<orxU32> data{};
+    };
+
+    // Read a bitmap into sheet, unless it already holds it
+    orxBOOL Read(const orxBITMAP *bitmap, Sheet &sheet)
+    {
+        if (sheet.bitmap == bitmap && !sheet.data.empty())
+            return orxTRUE;
+
+        sheet = Sheet{};
+        orxFLOAT width, height;
+        if (bitmap == orxNULL || orxDisplay_GetBitmapSize(bitmap, &width, &height) == orxSTATUS_FAILURE || width < orxFLOAT_1 || height < orxFLOAT_1)
+            return orxFALSE;
+        sheet.width = (orxU32)width;
+        sheet.height = (orxU32)height;
+        sheet.data.resize((size_t)sheet.width * sheet.height);
+        if (orxDisplay_GetBitmapData(bitmap, (orxU8 *)sheet.data.data(), (orxU32)(sheet.data.size() * sizeof(orxU32))) == orxSTATUS_FAILURE)
+        {
+            sheet.data.clear();
+            return orxFALSE;
+        }
+        sheet.bitmap = bitmap;
+        return orxTRUE;
+    }
+
+    // Pixels are RGBA bytes, build the mask from bytes so it holds on any endianness
+    orxU32 GetAlphaMask()
+    {
+        const orxU8 alphaBytes[4] = {0x00, 0x00, 0x00, 0xFF};
+        orxU32 alphaMask;
+        orxMemory_Copy(&alphaMask, alphaBytes, sizeof(alphaMask));
+        return alphaMask;
+    }
+
+    // OR-reduce a region into per-column and per-row words, accumulating
+    // into columnBits. Whole pixels are combined instead of testing alpha
+    // one by one, four at a time with SSE2, and callers mask alpha once per
+    // line. Compilers don't vectorize the plain loop at -O2 as columnBits
+    // may alias the sheet.
+    void Reduce(const Sheet &sheet, orxU32 x, orxU32 y, orxU32 width, orxU32 height, orxU32 *columnBits, orxU32 *rowBits)
+    {
+        for (orxU32 j = 0; j < height; j++)
+        {
+            const orxU32 *row = &sheet.data[(size_t)(y + j) * sheet.width + x];
+            orxU32 bits = 0;
+            orxU32 i = 0;
+#ifdef __animtesterSSE2__
+            // Unaligned, regions start at any pixel
+            auto rowVector = _mm_setzero_si128();
+            for (; i + 4 <= width; i += 4)
+            {
+                auto pixels = _mm_loadu_si128((const __m128i *)(row + i));
+                auto columns = _mm_loadu_si128((const __m128i *)(columnBits + i));
+                _mm_storeu_si128((__m128i *)(columnBits + i), _mm_or_si128(columns, pixels));
+                rowVector = _mm_or_si128(rowVector, pixels);
+            }
+            rowVector = _mm_or_si128(rowVector, _mm_shuffle_epi32(rowVector, _MM_SHUFFLE(1, 0, 3, 2)));
+            rowVector = _mm_or_si128(rowVector, _mm_shuffle_epi32(rowVector, _MM_SHUFFLE(2, 3, 0, 1)));
+            bits = (orxU32)_mm_cvtsi128_si32(rowVector);
+#endif
+            for (; i < width; i++)
+            {
+                columnBits[i] |= row[i];
+                bits |= row[i];
+            }
+            rowBits[j] = bits;
+        }
+    }
+}
+
+namespace grid
+{
+    // Frame grid found from a texture's alpha channel. Cells are laid out
+    // from the top left corner of the texture, in row-major order.
+    struct Grid
+    {
+        orxU32 width = 0;
+        orxU32 height = 0;
+        // Zero when no grid could be found
+        orxU32 cellWidth = 0;
+        orxU32 cellHeight = 0;
+        orxU32 columns = 0;
+        orxU32 rows = 0;
+        // One flag per cell, set when the cell has any visible pixel
+        std::vector<bool> occupied{};
+        orxU32 emptyCells = 0;
+        orxDOUBLE scanTime = 0.0;
+
+        bool IsOccupied(orxU32 column, orxU32 row) const
+        {
+            return column < columns && row < rows && occupied[row * columns + column];
+        }
+
+        // Frames up to the last occupied cell of a row, or of the whole grid
+        orxU32 GetFrames(orxS32 row = -1) const
+        {
+            auto first = row < 0 ? 0 : row * columns;
+            auto last = row < 0 ? occupied.size() : first + columns;
+            for (auto i = last; i > first; i--)
+                if (occupied[i - 1])
+                    return i - first;
+            return 0;
+        }
+    };
+
+    // Spans of consecutive lines holding visible pixels
+    struct Run
+    {
+        orxU32 start;
+        orxU32 end;
+    };
+
+    // Scans are cached per bitmap so hovering the texture only does lookups
+    std::map<const orxBITMAP *, Grid> cache{};
+
+    std::vector<Run> GetRuns(const std::vector<orxU32> &lines, orxU32 alphaMask)
+    {
+        std::vector<Run> runs{};
+        for (orxU32 i = 0; i < lines.size(); i++)
+        {
+            if (!(lines[i] & alphaMask))
+                continue;
+            if (runs.empty() || runs.back().end != i)
+                runs.push_back({i, i + 1});
+            else
+                runs.back().end = i + 1;
+        }
+        return runs;
+    }
+
+    // Smallest cell size that no run straddles, preferring sizes which evenly
+    // divide the texture. Sprites touching their neighbours can't be split.
+    orxU32 GetCellSize(const std::vector<Run> &runs, orxU32 size)
+    {
+        orxU32 longest = 0;
+        for (auto &run : runs)
+            longest = orxMAX(longest, run.end - run.start);
+
+        orxU32 fallback = 0;
+        for (auto cell = orxMAX(longest, 1u); cell < size; cell++)
+        {
+            auto fits = std::all_of(runs.begin(), runs.end(), [cell](const Run &run)
+                                    { return run.start / cell == (run.end - 1) / cell; });
+            if (!fits)
+                continue;
+            if (size % cell == 0)
+                return cell;
+            if (fallback == 0)
+                fallback = cell;
+        }
+        return fallback != 0 ? fallback : size;
+    }
+
+    Grid Scan(const orxBITMAP *bitmap)
+    {
+        Grid grid{};
+        auto start = orxSystem_GetTime();
+
+        pixels::Sheet sheet{};
+        if (!pixels::Read(bitmap, sheet))
+            return grid;
+        grid.width = sheet.width;
+        grid.height = sheet.height;
+
+        auto alphaMask = pixels::GetAlphaMask();
+        std::vector<orxU32> columnBits(grid.width, 0);
+        std::vector<orxU32> rowBits(grid.height, 0);
+        pixels::Reduce(sheet, 0, 0, grid.width, grid.height, columnBits.data(), rowBits.data());
+
+        auto columnRuns = GetRuns(columnBits, alphaMask);
+        auto rowRuns = GetRuns(rowBits, alphaMask);
+        if (columnRuns.empty() || rowRuns.empty())
+            return grid;
+
+        grid.cellWidth = GetCellSize(columnRuns, grid.width);
+        grid.cellHeight = GetCellSize(rowRuns, grid.height);
+        grid.columns = orxMAX(grid.width / grid.cellWidth, 1u);
+        grid.rows = orxMAX(grid.height / grid.cellHeight, 1u);
+        grid.occupied.resize(grid.columns * grid.rows);
+
+        // Second pass, one band of cell rows at a time, reusing the column
+        // buffer; row words come out the same as in the first pass
+        for (orxU32 row = 0; row < grid.rows; row++)
+        {
+            std::fill(columnBits.begin(), columnBits.end(), 0);
+            auto first = row * grid.cellHeight;
+            auto last = orxMIN(first + grid.cellHeight, grid.height);
+            pixels::Reduce(sheet, 0, first, grid.width, last - first, columnBits.data(), &rowBits[first]);
+            for (orxU32 column = 0; column < grid.columns; column++)
+            {
+                orxU32 bits = 0;
+                auto end = orxMIN((column + 1) * grid.cellWidth, grid.width);
+                for (auto x = column * grid.cellWidth; x < end; x++)
+                    bits |= columnBits[x];
+                grid.occupied[row * grid.columns + column] = (bits & alphaMask) != 0;
+            }
+        }
+
+        auto frames = grid.GetFrames();
+        grid.emptyCells = (orxU32)std::count(grid.occupied.begin(), grid.occupied.begin() + frames, false);
+        grid.scanTime = orxSystem_GetTime() - start;
+        return grid;
+    }
+
+    const Grid &Get(const orxTEXTURE *texture)
+    {
+        auto bitmap = orxTexture_GetBitmap(texture);
+        auto found = cache.find(bitmap);
+        if (found == cache.end())
+            found = cache.emplace(bitmap, Scan(bitmap)).first;
+        return found->second;
+    }
+
+    void Invalidate(const orxTEXTURE *texture)
+    {
+        cache.erase(orxTexture_GetBitmap(texture));
+    }
+}
+
+namespace layout
+{
+    // Push the section a key is read from: the animation section when it
+    // has the key, the animation set otherwise
+    void PushOwner(const orxSTRING section, const orxSTRING animSetName, const orxSTRING key)
+    {
+        orxConfig_PushSection(section);
+        if (orxConfig_HasValue(key))
+            return;
+        orxConfig_PopSection();
+        orxConfig_PushSection(animSetName);
+    }
+
+    orxVECTOR GetVector(const orxSTRING section, const orxSTRING animSetName, const orxSTRING key)
+    {
+        orxVECTOR value = orxVECTOR_0;
+        PushOwner(section, animSetName, key);
+        orxConfig_GetVector(key, &value);
+        orxConfig_PopSection();
+        return value;
+    }
+
+    struct Rect
+    {
+        orxU32 x;
+        orxU32 y;
+        orxU32 width;
+        orxU32 height;
+    };
+
+    // Where the keys of a sheet animation sit in its texture
+    struct Layout
+    {
+        // Interned animation section
+        const orxCHAR *section = orxNULL;
+        const orxTEXTURE *texture = orxNULL;
+        orxU32 frames = 0;
+        orxU32 x = 0;
+        orxU32 y = 0;
+        orxU32 frameWidth = 0;
+        orxU32 frameHeight = 0;
+        orxU32 columns = 0;
+        orxU32 rows = 0;
+        bool columnMajor = false;
+        bool reverseX = false;
+        bool reverseY = false;
+        // False once packed in an atlas: every key has bounds of its own
+        // and the texture grid no longer means anything
+        bool grid = false;
+
+        // Top left corner of key i, 0-based
+        void GetKeyOrigin(orxU32 i, orxU32 &keyX, orxU32 &keyY) const
+        {
+            auto column = columnMajor ? i / rows : i % columns;
+            auto row = columnMajor ? i % rows : i / columns;
+            if (reverseX)
+                column = columns - 1 - column;
+            if (reverseY)
+                row = rows - 1 - row;
+            keyX = x + column * frameWidth;
+            keyY = y + row * frameHeight;
+        }
+
+        // Rectangle of key i, 0-based, including per-key overrides such as
+        // trimmed bounds
+        Rect GetKeyRect(orxU32 i) const
+        {
+            Rect rect{0, 0, frameWidth, frameHeight};
+            if (grid)
+                GetKeyOrigin(i, rect.x, rect.y);
+
+            auto keySection = config::GetKeySectionName(section, i + 1);
+            if (orxConfig_HasSection(keySection))
+            {
+                // Key sections inherit from the animation, only their own
+                // values are overrides
+                orxVECTOR value;
+                orxConfig_PushSection(keySection);
+                if (orxConfig_HasValue("TextureOrigin") && !orxConfig_IsInheritedValue("TextureOrigin") && orxConfig_GetVector("TextureOrigin", &value))
+                {
+                    rect.x = (orxU32)value.fX;
+                    rect.y = (orxU32)value.fY;
+                }
+                if (orxConfig_HasValue("TextureSize") && !orxConfig_IsInheritedValue("TextureSize") && orxConfig_GetVector("TextureSize", &value))
+                {
+                    rect.width = (orxU32)value.fX;
+                    rect.height = (orxU32)value.fY;
+                }
+                orxConfig_PopSection();
+            }
+            return rect;
+        }
+    };
+
+    // Whether key i, 0-based, has bounds of its own rather than inherited
+    bool HasKeyBounds(const orxSTRING section, orxU32 i)
+    {
+        auto keySection = config::GetKeySectionName(section, i + 1);
+        if (!orxConfig_HasSection(keySection))
+            return false;
+        orxConfig_PushSection(keySection);
+        auto isOwn = [](const orxSTRING key)
+        { return orxConfig_HasValue(key) && !orxConfig_IsInheritedValue(key); };
+        auto result = isOwn("TextureOrigin") && isOwn("TextureSize");
+        orxConfig_PopSection();
+        return result;
+    }
+
+    // Same rules as orx: the region defaults to the rest of the texture, a
+    // frame defaults to the whole region and Direction lists the fast axis
+    // first, right down by default. Fails when the frames don't fit.
+    orxSTATUS GetGrid(const orxSTRING section, const orxSTRING animSetName, orxFLOAT textureWidth, orxFLOAT textureHeight, Layout &layout)
+    {
+        auto origin = GetVector(section, animSetName, "TextureOrigin");
+        auto size = GetVector(section, animSetName, "TextureSize");
+        auto frameSize = GetVector(section, animSetName, "FrameSize");
+        // Past the texture, the default region would be negative
+        if (origin.fX < orxFLOAT_0 || origin.fY < orxFLOAT_0 || origin.fX >= textureWidth || origin.fY >= textureHeight)
+            return orxSTATUS_FAILURE;
+        layout.x = (orxU32)origin.fX;
+        layout.y = (orxU32)origin.fY;
+        auto regionWidth = size.fX > orxFLOAT_0 ? (orxU32)size.fX : (orxU32)textureWidth - layout.x;
+        auto regionHeight = size.fY > orxFLOAT_0 ? (orxU32)size.fY : (orxU32)textureHeight - layout.y;
+        layout.frameWidth = frameSize.fX > orxFLOAT_0 ? (orxU32)frameSize.fX : regionWidth;
+        layout.frameHeight = frameSize.fY > orxFLOAT_0 ? (orxU32)frameSize.fY : regionHeight;
+        if (layout.frameWidth == 0 || layout.frameHeight == 0 ||
+            (orxU64)layout.x + regionWidth > (orxU32)textureWidth || (orxU64)layout.y + regionHeight > (orxU32)textureHeight)
+            return orxSTATUS_FAILURE;
+        layout.columns = regionWidth / layout.frameWidth;
+        layout.rows = regionHeight / layout.frameHeight;
+        if (layout.frames > layout.columns * layout.rows)
+            return orxSTATUS_FAILURE;
+
+        PushOwner(section, animSetName, "Direction");
+        std::string first = orxConfig_GetListCount("Direction") > 0 ? orxConfig_GetListString("Direction", 0) : "right";
+        std::string second = orxConfig_GetListCount("Direction") > 1 ? orxConfig_GetListString("Direction", 1) : "down";
+        orxConfig_PopSection();
+        layout.columnMajor = first == "down" || first == "up";
+        layout.reverseX = first == "left" || second == "left";
+        layout.reverseY = first == "up" || second == "up";
+        return orxSTATUS_SUCCESS;
+    }
+
+    // The texture grid, unless every key has bounds of its own and some lie
+    // outside their cell, as atlas::Build leaves them. Fails when neither
+    // describes the keys, or a key's bounds leave the texture.
+    orxSTATUS Get(const orxSTRING animSetName, const orxSTRING animName, Layout &layout)
+    {
+        auto section = config::GetAnimSectionName(animSetName, animName);
+        layout.section = section;
+        layout.frames = (orxU32)orxMAX(config::GetAnimFrames(animSetName, animName), 0);
+
+        PushOwner(section, animSetName, "Texture");
+        layout.texture = orxTexture_Get(orxConfig_GetString("Texture"));
+        orxConfig_PopSection();
+        if (layout.frames == 0 || layout.texture == orxNULL)
+            return orxSTATUS_FAILURE;
+
+        orxFLOAT textureWidth, textureHeight;
+        orxTexture_GetSize(layout.texture, &textureWidth, &textureHeight);
+        layout.grid = GetGrid(section, animSetName, textureWidth, textureHeight, layout) == orxSTATUS_SUCCESS;
+
+        auto hasAllBounds = true, isOutsideCell = false;
+        for (orxU32 i = 0; i < layout.frames; i++)
+        {
+            if (!HasKeyBounds(section, i))
+            {
+                hasAllBounds = false;
+                continue;
+            }
+            auto rect = layout.GetKeyRect(i);
+            if ((orxU64)rect.x + rect.width > (orxU32)textureWidth || (orxU64)rect.y + rect.height > (orxU32)textureHeight)
+                return orxSTATUS_FAILURE;
+            if (layout.grid)
+            {
+                orxU32 x, y;
+                layout.GetKeyOrigin(i, x, y);
+                isOutsideCell = isOutsideCell || rect.x < x || rect.y < y ||
+                                (orxU64)rect.x + rect.width > (orxU64)x + layout.frameWidth ||
+                                (orxU64)rect.y + rect.height > (orxU64)y + layout.frameHeight;
+            }
+        }
+        if (hasAllBounds && isOutsideCell)
+            layout.grid = false;
+        return layout.grid || hasAllBounds ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    }
+}
+
+namespace trim
+{
+    // Trimming shrinks each key of an animation to the bounding box of its
+    // visible pixels. Overrides go to per-key sections named after the
+    // animation section and the 1-based key index, where orx looks for
+    // them, and pivots move along so trimmed keys are drawn in place.
+    const orxCHAR *overrideKeys[] = {"TextureOrigin", "TextureSize", "Pivot"};
+
+    // Pixels shaded per loop of an animation, before and after trimming
+    struct Report
+    {
+        orxU32 frames = 0;
+        orxU64 cellPixels = 0;
+        orxU64 trimmedPixels = 0;
+    };
+
+    // Keyed by animation section
+    std::map<std::string, Report> reports{};
+
+    // Pivot in pixels, with literals (center, bottom left, ...) resolved
+    // against the frame size the way orxGraphic does: an axis without a
+    // word of its own is centred, then truncate or round apply to both
+    orxVECTOR GetPivot(const orxSTRING section, const orxSTRING animSetName, orxFLOAT width, orxFLOAT height)
+    {
+        orxVECTOR pivot = orxVECTOR_0;
+        layout::PushOwner(section, animSetName, "Pivot");
+        if (orxConfig_HasValue("Pivot") && orxConfig_GetVector("Pivot", &pivot) == orxNULL)
+        {
+            std::string literal = orxConfig_GetString("Pivot");
+            std::transform(literal.begin(), literal.end(), literal.begin(), ::tolower);
+            auto has = [&literal](const char *word)
+            { return literal.find(word) != std::string::npos; };
+            pivot.fX = has("left") ? orxFLOAT_0 : has("right") ? width : width * 0.5f;
+            pivot.fY = has("top") ? orxFLOAT_0 : has("bottom") ? height : height * 0.5f;
+            if (has("truncate"))
+            {
+                pivot.fX = orxMath_Floor(pivot.fX);
+                pivot.fY = orxMath_Floor(pivot.fY);
+            }
+            else if (has("round"))
+            {
+                pivot.fX = orxMath_Round(pivot.fX);
+                pivot.fY = orxMath_Round(pivot.fY);
+            }
+        }
+        orxConfig_PopSection();
+        return pivot;
+    }
+
+    // Trim every key of an animation, reading pixels through sheet so
+    // animations sharing a texture only read it once
+    orxSTATUS Apply(pixels::Sheet &sheet, const orxSTRING animSetName, const orxSTRING animName)
+    {
+        layout::Layout layout{};
+        if (layout::Get(animSetName, animName, layout) == orxSTATUS_FAILURE || !pixels::Read(orxTexture_GetBitmap(layout.texture), sheet))
+            return orxSTATUS_FAILURE;
+        auto section = layout.section;
+
+        auto alphaMask = pixels::GetAlphaMask();
+        auto isVisible = [alphaMask](orxU32 bits)
+        { return (bits & alphaMask) != 0; };
+        std::vector<orxU32> columnBits;
+        std::vector<orxU32> rowBits;
+
+        Report report{};
+        for (orxU32 i = 0; i < layout.frames; i++)
+        {
+            // Keys are trimmed from their grid cell, or once packed in an
+            // atlas, from their current bounds with their own pivot
+            auto keySection = config::GetKeySectionName(section, i + 1);
+            auto cell = layout.GetKeyRect(i);
+            if (layout.grid)
+            {
+                cell.width = layout.frameWidth;
+                cell.height = layout.frameHeight;
+                layout.GetKeyOrigin(i, cell.x, cell.y);
+            }
+            auto x = cell.x, y = cell.y, frameWidth = cell.width, frameHeight = cell.height;
+            auto pivot = GetPivot(layout.grid ? section : keySection, animSetName, (orxFLOAT)frameWidth, (orxFLOAT)frameHeight);
+
+            columnBits.assign(frameWidth, 0);
+            rowBits.resize(frameHeight);
+            pixels::Reduce(sheet, x, y, frameWidth, frameHeight, columnBits.data(), rowBits.data());
+
+            // Empty keys keep a single transparent pixel, orx needs a size
+            orxU32 left = 0, top = 0, right = 1, bottom = 1;
+            auto visibleColumn = std::find_if(columnBits.begin(), columnBits.end(), isVisible);
+            if (visibleColumn != columnBits.end())
+            {
+                left = visibleColumn - columnBits.begin();
+                right = frameWidth - (std::find_if(columnBits.rbegin(), columnBits.rend(), isVisible) - columnBits.rbegin());
+                top = std::find_if(rowBits.begin(), rowBits.end(), isVisible) - rowBits.begin();
+                bottom = frameHeight - (std::find_if(rowBits.rbegin(), rowBits.rend(), isVisible) - rowBits.rbegin());
+            }
+
+            orxConfig_SetParent(keySection, section);
+            orxConfig_PushSection(keySection);
+            orxVECTOR keyOrigin = {(orxFLOAT)(x + left), (orxFLOAT)(y + top), orxFLOAT_0};
+            orxVECTOR keySize = {(orxFLOAT)(right - left), (orxFLOAT)(bottom - top), orxFLOAT_0};
+            orxVECTOR keyPivot = {pivot.fX - left, pivot.fY - top, pivot.fZ};
+            orxConfig_SetVector("TextureOrigin", &keyOrigin);
+            orxConfig_SetVector("TextureSize", &keySize);
+            orxConfig_SetVector("Pivot", &keyPivot);
+            orxConfig_PopSection();
+            config::MarkSectionDirty(keySection);
+
+            report.frames++;
+            report.cellPixels += (orxU64)frameWidth * frameHeight;
+            report.trimmedPixels += (right - left) * (bottom - top);
+        }
+
+        reports[section] = report;
+        return orxSTATUS_SUCCESS;
+    }
+
+    // Drop the overrides written by Apply, and key sections left empty.
+    // Fails on keys packed in an atlas, they have no cell to go back to.
+    orxSTATUS Clear(const orxSTRING animSetName, const orxSTRING animName)
+    {
+        layout::Layout layout{};
+        if (layout::Get(animSetName, animName, layout) == orxSTATUS_SUCCESS && !layout.grid)
+            return orxSTATUS_FAILURE;
+        auto section = config::GetAnimSectionName(animSetName, animName);
+        auto frames = config::GetAnimFrames(animSetName, animName);
+        for (orxS32 i = 1; i <= frames; i++)
+        {
+            auto keySection = config::GetKeySectionName(section, i);
+            if (!orxConfig_HasSection(keySection))
+                continue;
+            orxConfig_PushSection(keySection);
+            for (auto key : overrideKeys)
+                orxConfig_ClearValue(key);
+            auto empty = orxConfig_GetKeyCount() == 0;
+            orxConfig_PopSection();
+            if (empty)
+                orxConfig_ClearSection(keySection);
+            config::MarkSectionDirty(keySection);
+        }
+        reports.erase(section);
+        return orxSTATUS_SUCCESS;
+    }
+}
+
+namespace dedup
+{
+    // Bit-identical keys are found by hashing each key's pixels, then
+    // comparing candidates with the same hash byte by byte. Collapsing
+    // points every duplicate at the first copy in the texture and merges
+    // runs of identical keys into a single, longer key.
+
+    // Overrides which collapsing rewrites, any other per-key value (events,
+    // pivots, ...) has to match for keys to merge
+    const orxCHAR *rewrittenKeys[] = {"TextureOrigin", "TextureSize", "KeyDuration"};
+
+    using Values = std::map<std::string, std::vector<std::string>>;
+
+    struct Key
+    {
+        size_t anim;
+        orxU32 index;
+        layout::Rect rect;
+        orxFLOAT duration;
+        Values overrides;
+        // First key in the set with the same pixels, possibly itself
+        size_t canonical;
+    };
+
+    struct Report
+    {
+        orxU32 keys = 0;
+        // Keys whose pixels are a copy of another rectangle of the texture
+        orxU32 duplicateKeys = 0;
+        // Keys dropped by merging runs of identical keys
+        orxU32 mergedKeys = 0;
+        // Texture memory taken by duplicated rectangles, reclaimable by a repack
+        orxU64 duplicateBytes = 0;
+        // Animations not laid out in the set's texture
+        orxU32 skippedAnims = 0;
+        std::vector<std::string> groups{};
+        orxDOUBLE scanTime = 0.0;
+    };
+
+    std::optional<Report> report{};
+
+    // XXH64 constants and round, fed with whole pixels
+    const orxU64 prime1 = 0x9E3779B185EBCA87ull;
+    const orxU64 prime2 = 0xC2B2AE3D27D4EB4Full;
+    const orxU64 prime3 = 0x165667B19E3779F9ull;
+
+    orxU64 RotateLeft(orxU64 value, int bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    orxU64 Round(orxU64 acc, orxU64 input)
+    {
+        return RotateLeft(acc + input * prime2, 31) * prime1;
+    }
+
+    // Four independent lanes keep the multiplies pipelined, identical
+    // rectangles hash identically wherever they sit in the sheet
+    orxU64 Hash(const pixels::Sheet &sheet, const layout::Rect &rect)
+    {
+        orxU64 lanes[4] = {prime1 + prime2, prime2, 0, 0 - prime1};
+        for (orxU32 j = 0; j < rect.height; j++)
+        {
+            const orxU32 *row = &sheet.data[(size_t)(rect.y + j) * sheet.width + rect.x];
+            orxU32 i = 0;
+            for (; i + 4 <= rect.width; i += 4)
+            {
+                lanes[0] = Round(lanes[0], row[i]);
+                lanes[1] = Round(lanes[1], row[i + 1]);
+                lanes[2] = Round(lanes[2], row[i + 2]);
+                lanes[3] = Round(lanes[3], row[i + 3]);
+            }
+            for (; i < rect.width; i++)
+                lanes[0] = Round(lanes[0], row[i]);
+        }
+        auto hash = RotateLeft(lanes[0], 1) + RotateLeft(lanes[1], 7) + RotateLeft(lanes[2], 12) + RotateLeft(lanes[3], 18);
+        hash ^= ((orxU64)rect.width << 32) | rect.height;
+        hash ^= hash >> 33;
+        hash *= prime2;
+        hash ^= hash >> 29;
+        hash *= prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    bool IsEqual(const pixels::Sheet &sheet, const layout::Rect &a, const layout::Rect &b)
+    {
+        if (a.width != b.width || a.height != b.height)
+            return false;
+        for (orxU32 j = 0; j < a.height; j++)
+        {
+            auto rowA = &sheet.data[(size_t)(a.y + j) * sheet.width + a.x];
+            auto rowB = &sheet.data[(size_t)(b.y + j) * sheet.width + b.x];
+            if (orxMemory_Compare(rowA, rowB, a.width * sizeof(orxU32)) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    bool IsSameLocation(const layout::Rect &a, const layout::Rect &b)
+    {
+        return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+    }
+
+    // A key section's own values, minus the ones collapsing rewrites
+    Values GetOverrides(const orxSTRING keySection)
+    {
+        Values values{};
+        if (!orxConfig_HasSection(keySection))
+            return values;
+        orxConfig_PushSection(keySection);
+        for (orxU32 i = 0, count = orxConfig_GetKeyCount(); i < count; i++)
+        {
+            auto key = orxConfig_GetKey(i);
+            if (std::any_of(std::begin(rewrittenKeys), std::end(rewrittenKeys), [key](const orxCHAR *rewritten)
+                            { return orxString_Compare(key, rewritten) == 0; }))
+                continue;
+            auto &list = values[key];
+            for (orxS32 j = 0, listCount = orxConfig_GetListCount(key); j < listCount; j++)
+                list.emplace_back(orxConfig_GetListString(key, j));
+        }
+        orxConfig_PopSection();
+        return values;
+    }
+
+    // Consecutive keys of an animation which can become a single key
+    bool CanMerge(const Key &a, const Key &b)
+    {
+        return a.anim == b.anim && a.canonical == b.canonical && a.overrides == b.overrides;
+    }
+
+    struct Analysis
+    {
+        std::vector<layout::Layout> layouts{};
+        std::vector<const orxCHAR *> names{};
+        std::vector<Key> keys{};
+    };
+
+    // Hash every key of the set's animations laid out in its texture
+    Analysis Analyze(const orxANIMSET *animSet)
+    {
+        auto start = orxSystem_GetTime();
+        auto animSetName = orxAnimSet_GetName(animSet);
+        const auto &index = animset::GetIndex(animSet);
+        Analysis analysis{};
+        Report result{};
+
+        orxConfig_PushSection(animSetName);
+        auto texture = orxTexture_Get(orxConfig_GetString("Texture"));
+        orxConfig_PopSection();
+        pixels::Sheet sheet{};
+        if (texture == orxNULL || !pixels::Read(orxTexture_GetBitmap(texture), sheet))
+        {
+            report = result;
+            return analysis;
+        }
+
+        std::map<orxU64, std::vector<size_t>> candidates{};
+        for (auto name : index.names)
+        {
+            // Key overrides may point anywhere, the whole animation is left
+            // alone when one of them is out of the texture
+            layout::Layout animLayout{};
+            auto fits = layout::Get(animSetName, name, animLayout) == orxSTATUS_SUCCESS && animLayout.texture == texture;
+            for (orxU32 i = 0; fits && i < animLayout.frames; i++)
+            {
+                auto rect = animLayout.GetKeyRect(i);
+                fits = rect.x + rect.width <= sheet.width && rect.y + rect.height <= sheet.height;
+            }
+            if (!fits)
+            {
+                result.skippedAnims++;
+                continue;
+            }
+
+            layout::PushOwner(animLayout.section, animSetName, "KeyDuration");
+            auto animDuration = orxConfig_GetFloat("KeyDuration");
+            orxConfig_PopSection();
+
+            for (orxU32 i = 0; i < animLayout.frames; i++)
+            {
+                Key key{analysis.layouts.size(), i, animLayout.GetKeyRect(i), animDuration, {}, analysis.keys.size()};
+
+                auto keySection = config::GetKeySectionName(animLayout.section, i + 1);
+                if (orxConfig_HasSection(keySection))
+                {
+                    orxConfig_PushSection(keySection);
+                    if (orxConfig_HasValue("KeyDuration") && !orxConfig_IsInheritedValue("KeyDuration"))
+                        key.duration = orxConfig_GetFloat("KeyDuration");
+                    orxConfig_PopSection();
+                    key.overrides = GetOverrides(keySection);
+                }
+
+                auto &bucket = candidates[Hash(sheet, key.rect)];
+                auto match = std::find_if(bucket.begin(), bucket.end(), [&](size_t other)
+                                          { return IsEqual(sheet, analysis.keys[other].rect, key.rect); });
+                if (match != bucket.end())
+                    key.canonical = *match;
+                else
+                    bucket.push_back(key.canonical);
+                analysis.keys.push_back(key);
+            }
+
+            analysis.layouts.push_back(animLayout);
+            analysis.names.push_back(name);
+        }
+
+        // Duplicated rectangles are only counted once, keys already sharing
+        // a rectangle cost no texture memory
+        std::map<size_t, std::string> groups{};
+        std::set<std::tuple<orxU32, orxU32, orxU32, orxU32>> duplicated{};
+        for (size_t i = 0; i < analysis.keys.size(); i++)
+        {
+            const auto &key = analysis.keys[i];
+            const auto &canonical = analysis.keys[key.canonical];
+            result.keys++;
+            if (i > 0 && CanMerge(analysis.keys[i - 1], key))
+                result.mergedKeys++;
+            if (key.canonical == i)
+                continue;
+
+            if (!IsSameLocation(key.rect, canonical.rect))
+            {
+                result.duplicateKeys++;
+                if (duplicated.insert({key.rect.x, key.rect.y, key.rect.width, key.rect.height}).second)
+                    result.duplicateBytes += (orxU64)key.rect.width * key.rect.height * sizeof(orxU32);
+            }
+
+            auto &group = groups[key.canonical];
+            if (group.empty())
+            {
+                group = analysis.names[canonical.anim];
+                group += " " + std::to_string(canonical.index + 1);
+            }
+            group += ", ";
+            group += analysis.names[key.anim];
+            group += " " + std::to_string(key.index + 1);
+        }
+        for (auto &[canonical, group] : groups)
+            result.groups.push_back(std::move(group));
+
+        result.scanTime = orxSystem_GetTime() - start;
+        report = result;
+        return analysis;
+    }
+
+    // Rewrite the keys of every animation with duplicates: merged runs get
+    // the summed duration, and all keys read the first copy of their pixels
+    void Collapse(const orxANIMSET *animSet)
+    {
+        auto animSetName = orxAnimSet_GetName(animSet);
+        auto analysis = Analyze(animSet);
+
+        size_t first = 0;
+        for (size_t anim = 0; anim < analysis.layouts.size(); anim++)
+        {
+            const auto &animLayout = analysis.layouts[anim];
+            auto section = animLayout.section;
+            auto last = first;
+            while (last < analysis.keys.size() && analysis.keys[last].anim == anim)
+                last++;
+
+            // Runs of keys to merge, and whether anything changes at all
+            std::vector<std::pair<size_t, size_t>> runs{};
+            auto changed = false;
+            for (auto i = first; i < last; i++)
+            {
+                const auto &key = analysis.keys[i];
+                if (!IsSameLocation(key.rect, analysis.keys[key.canonical].rect))
+                    changed = true;
+                if (i > first && CanMerge(analysis.keys[i - 1], key))
+                {
+                    runs.back().second = i + 1;
+                    changed = true;
+                }
+                else
+                {
+                    runs.push_back({i, i + 1});
+                }
+            }
+            if (!changed)
+            {
+                first = last;
+                continue;
+            }
+
+            layout::PushOwner(section, animSetName, "KeyDuration");
+            auto animDuration = orxConfig_GetFloat("KeyDuration");
+            orxConfig_PopSection();
+
+            for (orxU32 i = 1; i <= animLayout.frames; i++)
+            {
+                auto keySection = config::GetKeySectionName(section, i);
+                if (orxConfig_HasSection(keySection))
+                    orxConfig_ClearSection(keySection);
+                config::MarkSectionDirty(keySection);
+            }
+
+            for (size_t run = 0; run < runs.size(); run++)
+            {
+                const auto &key = analysis.keys[runs[run].first];
+                const auto &rect = analysis.keys[key.canonical].rect;
+                orxFLOAT duration = orxFLOAT_0;
+                for (auto i = runs[run].first; i < runs[run].second; i++)
+                    duration += analysis.keys[i].duration;
+
+                auto keySection = config::GetKeySectionName(section, (orxU32)run + 1);
+                orxConfig_SetParent(keySection, section);
+                orxConfig_PushSection(keySection);
+                for (const auto &[name, list] : key.overrides)
+                {
+                    std::vector<const orxCHAR *> values{};
+                    for (const auto &value : list)
+                        values.push_back(value.c_str());
+                    orxConfig_SetListString(name.c_str(), values.data(), (orxU32)values.size());
+                }
+                orxVECTOR origin = {(orxFLOAT)rect.x, (orxFLOAT)rect.y, orxFLOAT_0};
+                orxVECTOR size = {(orxFLOAT)rect.width, (orxFLOAT)rect.height, orxFLOAT_0};
+                orxConfig_SetVector("TextureOrigin", &origin);
+                orxConfig_SetVector("TextureSize", &size);
+                if (duration != animDuration)
+                    orxConfig_SetFloat("KeyDuration", duration);
+                orxConfig_PopSection();
+                config::MarkSectionDirty(keySection);
+            }
+
+            config::SetAnimFrames(animSetName, analysis.names[anim], (orxU32)runs.size());
+            rebuild::MarkAnim(analysis.names[anim]);
+            first = last;
+        }
+
+        // Report on the collapsed set
+        Analyze(animSet);
+    }
+}
+
+namespace atlas
+{
+    // Repack the keys of one or more animation sets into a single
+    // power-of-two texture. Keys are taken as they are, so trimming and
+    // collapsing duplicates first gives the smallest atlas; keys sharing a
+    // rectangle share it in the atlas too.
+    const orxU32 maxSize = 8192;
+
+    struct Report
+    {
+        orxU32 width = 0;
+        orxU32 height = 0;
+        orxU32 rects = 0;
+        orxU32 keys = 0;
+        orxU64 usedPixels = 0;
+        orxU64 sourceBytes = 0;
+        orxDOUBLE packTime = 0.0;
+        std::string path{};
+        std::string error{};
+    };
+
+    std::optional<Report> report{};
+
+    // Animation set sections, in config order
+    std::vector<std::string> GetAnimSets()
+    {
+        std::vector<std::string> animSets{};
+        for (orxU32 i = 0, count = orxConfig_GetSectionCount(); i < count; i++)
+        {
+            auto section = orxConfig_GetSection(i);
+            orxConfig_PushSection(section);
+            auto isSet = orxConfig_HasValue("StartAnim") || orxConfig_HasValue("StartAnimList");
+            orxConfig_PopSection();
+            if (isSet)
+                animSets.emplace_back(section);
+        }
+        return animSets;
+    }
+
+    // Interned animation names of a set, read from the index of the set as
+    // orx creates it. Live objects may share the set, so its index is simply
+    // dropped rather than left behind for a GUID that's about to go away.
+    std::vector<const orxCHAR *> GetAnimNames(const orxSTRING animSetName)
+    {
+        std::vector<const orxCHAR *> names{};
+        auto animSet = orxAnimSet_CreateFromConfig(animSetName);
+        if (animSet != orxNULL)
+        {
+            names = animset::GetIndex(animSet).names;
+            animset::indices.erase(orxStructure_GetGUID(animSet));
+            orxAnimSet_Delete(animSet);
         }
-        orxConfig_PopSection();
+        return names;
     }
 
-    void AddStartAnim(const orxSTRING animSetName, const orxSTRING animName)
+    struct Source
     {
-        orxConfig_PushSection(animSetName);
-        orxConfig_AppendListString("StartAnimList", &animName, 1);
-        orxConfig_PopSection();
-    }
+        const orxTEXTURE *texture;
+        layout::Rect rect;
+    };
 
-    // Saving animation changes to config
-    std::set<std::string> sectionsToSave{};
+    struct Key
+    {
+        const orxCHAR *animSection;
+        const orxCHAR *section;
+        size_t source;
+    };
 
-    orxBOOL SaveCallback(const orxSTRING section, const orxSTRING key, const orxSTRING file, orxBOOL useEncryption)
+    // Try power-of-two sizes by increasing area, squarest first
+    bool Pack(std::vector<stbrp_rect> &rects, orxU32 minWidth, orxU32 minHeight, orxU64 area, orxU32 &width, orxU32 &height)
     {
-        return sectionsToSave.contains(std::string{section});
+        for (orxU32 exponent = 0; exponent <= 26; exponent++)
+        {
+            if (((orxU64)1 << exponent) < area)
+                continue;
+            // Odd exponents also get a tall variant of the wide size
+            for (orxU32 flip = 0; flip < (exponent % 2 == 0 ? 1u : 2u); flip++)
+            {
+                const orxU32 size[2] = {1u << ((exponent + 1 - flip) / 2), 1u << ((exponent + flip) / 2)};
+                if (size[0] < minWidth || size[1] < minHeight || size[0] > maxSize || size[1] > maxSize)
+                    continue;
+                std::vector<stbrp_node> nodes(size[0]);
+                stbrp_context context;
+                stbrp_init_target(&context, size[0], size[1], nodes.data(), (int)nodes.size());
+                if (stbrp_pack_rects(&context, rects.data(), (int)rects.size()))
+                {
+                    width = size[0];
+                    height = size[1];
+                    return true;
+                }
+            }
+        }
+        return false;
     }
 
-    void Save(const orxSTRING file, orxOBJECT *object)
+    // Pack the keys of animSetNames into textureName, saved next to the
+    // first set's texture, and point every key at its packed rectangle
+    orxSTATUS Build(const std::vector<std::string> &animSetNames, const orxSTRING textureName, orxU32 padding)
     {
-        // Save the animation set section
-        auto animSet = object::GetAnimSet(object);
-        sectionsToSave.insert(orxAnimSet_GetName(animSet));
+        auto start = orxSystem_GetTime();
+        Report result{};
+        std::map<const orxTEXTURE *, pixels::Sheet> sheets{};
+        std::vector<Source> sources{};
+        std::map<std::tuple<const orxTEXTURE *, orxU32, orxU32, orxU32, orxU32>, size_t> sourceIndices{};
+        std::vector<Key> keys{};
+        std::vector<const orxCHAR *> animSections{};
+        std::map<std::string, std::vector<const orxCHAR *>> animNames{};
 
-        // Save the section for each individual animation
-        auto anims = object::GetAnims(object);
-        for (auto anim : anims)
+        for (const auto &animSetName : animSetNames)
         {
-            orxCHAR buf[256];
-            GetAnimSectionName(orxAnimSet_GetName(animSet), orxAnim_GetName(anim), buf, sizeof(buf));
-            sectionsToSave.insert(buf);
-        }
-
-        orxConfig_Save(file, orxFALSE, SaveCallback);
+            auto &names = animNames[animSetName] = GetAnimNames(animSetName.c_str());
+            for (auto name : names)
+            {
+                layout::Layout animLayout{};
+                if (layout::Get(animSetName.c_str(), name, animLayout) == orxSTATUS_FAILURE)
+                    continue;
+                auto &sheet = sheets[animLayout.texture];
+                if (!pixels::Read(orxTexture_GetBitmap(animLayout.texture), sheet))
+                    continue;
 
-        // Clear the set of sections to save
-        sectionsToSave.clear();
-    }
+                animSections.push_back(animLayout.section);
+                for (orxU32 i = 0; i < animLayout.frames; i++)
+                {
+                    auto rect = animLayout.GetKeyRect(i);
+                    if (rect.x + rect.width > sheet.width || rect.y + rect.height > sheet.height)
+                    {
+                        result.error = std::string{name} + " has a key outside of its texture";
+                        report = result;
+                        return orxSTATUS_FAILURE;
+                    }
+                    auto [entry, created] = sourceIndices.try_emplace({animLayout.texture, rect.x, rect.y, rect.width, rect.height}, sources.size());
+                    if (created)
+                        sources.push_back({animLayout.texture, rect});
 
-}
+                    auto keySection = config::GetKeySectionName(animLayout.section, i + 1);
+                    keys.push_back({animLayout.section, keySection, entry->second});
+                }
+            }
+        }
+        if (sources.empty())
+        {
+            result.error = "no keys to pack";
+            report = result;
+            return orxSTATUS_FAILURE;
+        }
 
-namespace gui
-{
-    void AnimWindow(const orxSTRING animSetName, const orxSTRING name)
-    {
-        orxCHAR sectionName[256];
-        config::GetAnimSectionName(animSetName, name, sectionName, sizeof(sectionName));
+        // Padding keeps filtered samples from bleeding between keys
+        std::vector<stbrp_rect> rects(sources.size());
+        orxU32 minWidth = 0, minHeight = 0;
+        orxU64 area = 0;
+        for (size_t i = 0; i < sources.size(); i++)
+        {
+            const auto &rect = sources[i].rect;
+            rects[i].id = (int)i;
+            rects[i].w = (stbrp_coord)(rect.width + padding);
+            rects[i].h = (stbrp_coord)(rect.height + padding);
+            minWidth = orxMAX(minWidth, (orxU32)rects[i].w);
+            minHeight = orxMAX(minHeight, (orxU32)rects[i].h);
+            area += (orxU64)rects[i].w * rects[i].h;
+            result.usedPixels += (orxU64)rect.width * rect.height;
+        }
+        if (!Pack(rects, minWidth, minHeight, area, result.width, result.height))
+        {
+            result.error = "keys don't fit in a " + std::to_string(maxSize) + " texture";
+            report = result;
+            return orxSTATUS_FAILURE;
+        }
 
-        if (orxConfig_PushSection(sectionName))
+        // Copy each source rectangle to its packed location
+        std::vector<orxU32> atlasPixels((size_t)result.width * result.height, 0);
+        std::vector<layout::Rect> packed(sources.size());
+        for (const auto &rect : rects)
         {
-            orxCHAR buffer[256];
-            orxString_NPrint(buffer, sizeof(buffer), "Animation: %s", name);
-            ImGui::Begin(buffer);
+            const auto &source = sources[rect.id];
+            const auto &sheet = sheets[source.texture];
+            packed[rect.id] = {rect.x, rect.y, source.rect.width, source.rect.height};
+            for (orxU32 j = 0; j < source.rect.height; j++)
+                orxMemory_Copy(&atlasPixels[(size_t)(rect.y + j) * result.width + rect.x],
+                               &sheet.data[(size_t)(source.rect.y + j) * sheet.width + source.rect.x],
+                               source.rect.width * sizeof(orxU32));
+        }
+        for (const auto &[texture, sheet] : sheets)
+            result.sourceBytes += (orxU64)sheet.width * sheet.height * sizeof(orxU32);
 
-            // Number of frames
-            auto frames = config::GetAnimFrames(animSetName, name);
-            auto setFrames = ImGui::InputInt("Frames", &frames, 1, 2);
-            if (setFrames)
-            {
-                configChanged = orxTRUE;
-                config::SetAnimFrames(animSetName, name, frames);
-            }
+        // Save next to the first set's texture, and refer to it the same way
+        orxConfig_PushSection(animSetNames.front().c_str());
+        std::filesystem::path textureValue = orxConfig_GetString("Texture");
+        orxConfig_PopSection();
+        auto location = orxResource_Locate(orxTEXTURE_KZ_RESOURCE_GROUP, textureValue.string().c_str());
+        std::filesystem::path directory = location != orxNULL ? std::filesystem::path{orxResource_GetPath(location)}.parent_path() : std::filesystem::path{};
+        result.path = (directory / textureName).string();
+        auto atlasValue = (textureValue.parent_path() / textureName).generic_string();
 
-            // Frame duration
-            auto duration = orxConfig_GetFloat("KeyDuration");
-            auto setDuration = ImGui::InputFloat("Key Duration", &duration, 0.01, 0.05);
-            if (setDuration)
+        auto bitmap = orxDisplay_CreateBitmap(result.width, result.height);
+        auto status = orxSTATUS_FAILURE;
+        if (bitmap != orxNULL)
+        {
+            if (orxDisplay_SetBitmapData(bitmap, (const orxU8 *)atlasPixels.data(), (orxU32)(atlasPixels.size() * sizeof(orxU32))) == orxSTATUS_SUCCESS)
+                status = orxDisplay_SaveBitmap(bitmap, result.path.c_str());
+            orxDisplay_DeleteBitmap(bitmap);
+        }
+        if (status == orxSTATUS_FAILURE)
+        {
+            result.error = "can't write " + result.path;
+            report = result;
+            return orxSTATUS_FAILURE;
+        }
+
+        // Every key gets explicit bounds, so the grid of each animation is
+        // dropped: it described the old texture and wouldn't fit the atlas
+        auto atlas = atlasValue.c_str();
+        for (const auto &animSetName : animSetNames)
+        {
+            orxConfig_PushSection(animSetName.c_str());
+            orxConfig_SetString("Texture", atlas);
+            orxConfig_PopSection();
+            config::MarkDirty(animSetName.c_str(), "Texture");
+        }
+        for (const auto &section : animSections)
+        {
+            orxConfig_PushSection(section);
+            if (orxConfig_HasValue("Texture") && !orxConfig_IsInheritedValue("Texture"))
             {
-                configChanged = orxTRUE;
-                orxConfig_SetFloat("KeyDuration", duration);
+                orxConfig_SetString("Texture", atlas);
+                config::MarkDirty(section, "Texture");
             }
-
-            // Texture origin
-            orxVECTOR origin = orxVECTOR_0;
-            orxConfig_GetVector("TextureOrigin", &origin);
-            int x = origin.fX;
-            int y = origin.fY;
-            auto setX = ImGui::InputInt("X Origin", &x, 1, 8);
-            auto setY = ImGui::InputInt("Y Origin", &y, 1, 8);
-            if (setX || setY)
+            for (auto key : {"TextureOrigin", "TextureSize", "FrameSize"})
             {
-                configChanged = orxTRUE;
-                origin.fX = x;
-                origin.fY = y;
-                orxConfig_SetVector("TextureOrigin", &origin);
+                if (orxConfig_HasValue(key) && !orxConfig_IsInheritedValue(key))
+                {
+                    orxConfig_ClearValue(key);
+                    config::MarkDirty(section, key);
+                }
             }
-
-            ImGui::End();
             orxConfig_PopSection();
         }
+        for (const auto &key : keys)
+        {
+            const auto &rect = packed[key.source];
+            orxConfig_SetParent(key.section, key.animSection);
+            orxConfig_PushSection(key.section);
+            orxVECTOR origin = {(orxFLOAT)rect.x, (orxFLOAT)rect.y, orxFLOAT_0};
+            orxVECTOR size = {(orxFLOAT)rect.width, (orxFLOAT)rect.height, orxFLOAT_0};
+            orxConfig_SetVector("TextureOrigin", &origin);
+            orxConfig_SetVector("TextureSize", &size);
+            orxConfig_PopSection();
+            config::MarkSectionDirty(key.section);
+        }
+
+        // Sections go back to the files defining them, with each set's own
+        // file for anything that has none
+        std::map<std::string, std::unordered_set<std::string_view>> owned{};
+        for (const auto &animSetName : animSetNames)
+        {
+            auto &sections = owned[config::GetOriginPath(animSetName.c_str())];
+            sections.insert(orxString_Store(animSetName.c_str()));
+            for (auto name : animNames[animSetName])
+                sections.insert(config::GetAnimSectionName(animSetName.c_str(), name));
+        }
+        for (const auto &[file, sections] : owned)
+            config::SaveSections(file.c_str(), sections);
+
+        result.rects = (orxU32)sources.size();
+        result.keys = (orxU32)keys.size();
+        result.packTime = orxSystem_GetTime() - start;
+        report = result;
+        return orxSTATUS_SUCCESS;
     }
+}
 
-    void AnimConfig(const orxSTRING animSetName, const orxSTRING name)
+namespace gui
+{
+    void AnimWindow(model::AnimSet &set, model::Anim &anim)
     {
-        orxCHAR sectionName[256];
-        config::GetAnimSectionName(animSetName, name, sectionName, sizeof(sectionName));
+        orxCHAR buffer[256];
+        orxString_NPrint(buffer, sizeof(buffer), "Animation: %s", anim.name);
+        ImGui::Begin(buffer);
+
+        // Number of frames
+        int frames = anim.frames;
+        if (ImGui::InputInt("Frames", &frames, 1, 2))
+            model::SetFrames(set, anim, frames);
+
+        // Frame duration
+        auto duration = anim.keyDuration;
+        if (ImGui::InputFloat("Key Duration", &duration, 0.01, 0.05))
+            model::SetKeyDuration(anim, duration);
+
+        // Texture origin
+        int x = anim.textureOrigin.fX;
+        int y = anim.textureOrigin.fY;
+        auto setX = ImGui::InputInt("X Origin", &x, 1, 8);
+        auto setY = ImGui::InputInt("Y Origin", &y, 1, 8);
+        if (setX || setY)
+        {
+            orxVECTOR origin = {(orxFLOAT)x, (orxFLOAT)y, anim.textureOrigin.fZ};
+            model::SetTextureOrigin(anim, origin);
+        }
 
-        orxASSERT(orxConfig_PushSection(sectionName));
+        ImGui::End();
+    }
 
+    void AnimConfig(model::AnimSet &set, model::Anim &anim)
+    {
         // Frame ordering
         {
-            auto order1 = orxConfig_GetListString("Direction", 0);
             static orxCHAR rowBuf[64] = "right";
-            if (orxString_GetLength(order1) > 0)
-                orxString_NCopy(rowBuf, order1, sizeof(rowBuf));
-            auto order2 = orxConfig_GetListString("Direction", 1);
+            if (!anim.rowOrder.empty())
+                orxString_NCopy(rowBuf, anim.rowOrder.c_str(), sizeof(rowBuf));
             static orxCHAR columnBuf[64] = "down";
-            if (orxString_GetLength(order2) > 0)
-                orxString_NCopy(columnBuf, order2, sizeof(columnBuf));
+            if (!anim.columnOrder.empty())
+                orxString_NCopy(columnBuf, anim.columnOrder.c_str(), sizeof(columnBuf));
             ImGui::InputTextWithHint("Row order", "right", rowBuf, sizeof(rowBuf));
             auto rowChange = ImGui::IsItemDeactivatedAfterEdit();
             ImGui::InputTextWithHint("Column order", "down", columnBuf, sizeof(columnBuf));
             auto columnChange = ImGui::IsItemDeactivatedAfterEdit();
             if (rowChange || columnChange)
-            {
-                configChanged = orxTRUE;
-                orxConfig_ClearValue("Direction");
-                const orxCHAR *row = rowBuf;
-                const orxCHAR *col = columnBuf;
-                orxConfig_AppendListString("Direction", &row, 1);
-                orxConfig_AppendListString("Direction", &col, 1);
-            }
+                model::SetDirection(anim, rowBuf, columnBuf);
         }
 
         // Number of frames
-        auto frames = config::GetAnimFrames(animSetName, name);
-        auto setFrames = ImGui::InputInt("Frames", &frames, 1, 2);
-        if (setFrames)
-        {
-            configChanged = orxTRUE;
-            config::SetAnimFrames(animSetName, name, frames);
-        }
+        int frames = anim.frames;
+        if (ImGui::InputInt("Frames", &frames, 1, 2))
+            model::SetFrames(set, anim, frames);
 
         // Frame duration
-        auto duration = orxConfig_GetFloat("KeyDuration");
-        auto setDuration = ImGui::InputFloat("Key Duration", &duration, 0.01, 0.05);
-        if (setDuration)
-        {
-            configChanged = orxTRUE;
-            orxConfig_SetFloat("KeyDuration", duration);
-        }
+        auto duration = anim.keyDuration;
+        if (ImGui::InputFloat("Key Duration", &duration, 0.01, 0.05))
+            model::SetKeyDuration(anim, duration);
 
         // Texture size
         {
-            auto tmpSize = orxConfig_GetString("TextureSize");
             static orxCHAR size[64] = {'\0'};
-            orxString_NCopy(size, tmpSize, sizeof(size));
+            orxString_NCopy(size, anim.textureSize.c_str(), sizeof(size));
             ImGui::InputText("Texture Size", size, sizeof(size));
             if (ImGui::IsItemDeactivatedAfterEdit())
-            {
-                configChanged = orxTRUE;
-                orxConfig_SetString("TextureSize", size);
-            }
+                model::SetTextureSize(anim, size);
         }
 
         // Texture origin
-        orxVECTOR origin = orxVECTOR_0;
-        orxConfig_GetVector("TextureOrigin", &origin);
-        int x = origin.fX;
-        int y = origin.fY;
+        int x = anim.textureOrigin.fX;
+        int y = anim.textureOrigin.fY;
         auto setX = ImGui::InputInt("X Origin", &x, 1, 8);
         auto setY = ImGui::InputInt("Y Origin", &y, 1, 8);
         if (setX || setY)
         {
-            configChanged = orxTRUE;
-            origin.fX = x;
-            origin.fY = y;
-            orxConfig_SetVector("TextureOrigin", &origin);
+            orxVECTOR origin = {(orxFLOAT)x, (orxFLOAT)y, anim.textureOrigin.fZ};
+            model::SetTextureOrigin(anim, origin);
         }
 
-        orxConfig_PopSection();
+        if (!anim.keyOverrides.empty())
+            ImGui::TextDisabled("%u keys have their own section", (orxU32)anim.keyOverrides.size());
     }
 
     void AnimSetWindow(const orxANIMSET *animSet)
     {
-        auto animSetName = orxAnimSet_GetName(animSet);
-        auto configKey = "FrameSize";
-
-        orxASSERT(orxConfig_PushSection(animSetName));
+        PROFILE_SCOPE("gui::AnimSetWindow");
+        auto &set = model::Get(animSet);
+        auto animSetName = set.name.c_str();
 
         orxCHAR title[256];
         orxString_NPrint(title, sizeof(title), "Animation Set: %s", animSetName);
@@ -342,13 +4735,26 @@ namespace gui
         ImGui::Begin(title);
 
         // Save changes
+        auto origin = set.originPath.c_str();
         if (ImGui::Button("Save"))
         {
-            save = std::string{orxConfig_GetOrigin(animSetName)};
+            save = set.originPath;
         }
+        if (auto job = saver::GetJob(origin))
+        {
+            ImGui::SameLine();
+            if (job->inFlight)
+                ImGui::Text("Saving... (%u coalesced)", job->coalescedCount);
+            else if (job->lastStatus == orxSTATUS_FAILURE)
+                ImGui::TextColored({1.0f, 0.3f, 0.3f, 1.0f}, "Save failed");
+            else
+                ImGui::Text("Saved %u time(s), last in %.1f ms", job->saveCount, job->lastLatency * 1000.0);
+        }
+
+        auto frameSize = set.frameSize;
 
-        auto frameSize = orxVECTOR_0;
-        orxConfig_GetVector(configKey, &frameSize);
+        // Tools below edit config directly, the model is reloaded after them
+        auto reload = false;
 
         // Add a new animation
         {
@@ -358,18 +4764,7 @@ namespace gui
             ImGui::SmallButton("Add animation");
             if (ImGui::IsItemActivated())
             {
-                configChanged = orxTRUE;
-
-                config::SetAnimFrames(animSetName, newAnimName, 1);
-                config::AddStartAnim(animSetName, newAnimName);
-
-                orxCHAR sectionName[64];
-                config::GetAnimSectionName(animSetName, newAnimName, sectionName, sizeof(sectionName));
-                orxConfig_PushSection(sectionName);
-                orxConfig_SetFloat("KeyDuration", 0.1);
-                orxConfig_SetVector("TextureOrigin", &orxVECTOR_0);
-                orxConfig_PopSection();
-
+                model::AddAnim(set, newAnimName);
                 newAnimName[0] = '\0';
             }
         }
@@ -382,10 +4777,9 @@ namespace gui
             auto setY = ImGui::InputInt("Y Frame Size", &y, 1, 8);
             if (setX || setY)
             {
-                configChanged = orxTRUE;
                 frameSize.fX = x;
                 frameSize.fY = y;
-                orxConfig_SetVector(configKey, &frameSize);
+                model::SetFrameSize(set, frameSize);
             }
         }
 
@@ -394,10 +4788,9 @@ namespace gui
         {
             ImGui::Indent();
 
-            auto animations = animset::GetAnims(animSet);
-            for (auto anim : animations)
+            for (auto &anim : set.anims)
             {
-                auto name = orxAnim_GetName(anim);
+                auto name = anim.name;
                 if (ImGui::CollapsingHeader(name))
                 {
                     ImGui::PushID(name);
@@ -406,22 +4799,24 @@ namespace gui
                     // Config for the selected animation
                     if (ImGui::CollapsingHeader("Config"))
                     {
-                        AnimConfig(animSetName, name);
+                        AnimConfig(set, anim);
                     }
 
-                    // Track changes to animation links so we can apply them
-                    auto changed = false;
-                    std::vector<std::string> updatedLinks;
-
                     // Animation links for the selected animation
                     if (ImGui::CollapsingHeader("Links"))
                     {
-                        const auto links = config::GetAnimLinks(animSetName, name);
-                        for (const auto link : links)
+                        const auto &links = anim.links;
+
+                        // Track changes to animation links so we can apply them
+                        auto editIndex = links.size();
+                        auto remove = false;
+                        orxCHAR appliedLink[64] = "";
+
+                        for (size_t i = 0; i < links.size(); i++)
                         {
+                            auto link = links[i].c_str();
                             ImGui::PushID(link);
 
-                            std::string originalLink{link};
                             static orxCHAR linkText[64];
                             orxString_NCopy(linkText, link, sizeof(linkText));
 
@@ -429,19 +4824,15 @@ namespace gui
                             ImGui::SameLine();
                             auto apply = ImGui::Button("Apply");
                             ImGui::SameLine();
-                            auto remove = ImGui::Button("Remove");
+                            auto removeLink = ImGui::Button("Remove");
 
-                            if (!remove)
+                            if (apply || removeLink)
                             {
-                                if (!apply)
-                                    updatedLinks.push_back(originalLink);
-                                else
-                                    updatedLinks.push_back(std::string{linkText});
+                                editIndex = i;
+                                remove = removeLink;
+                                orxString_NCopy(appliedLink, linkText, sizeof(appliedLink));
                             }
 
-                            if (apply || remove)
-                                changed = true;
-
                             ImGui::PopID();
                         }
 
@@ -452,27 +4843,272 @@ namespace gui
                         ImGui::SameLine();
                         auto add = ImGui::Button("Add");
                         ImGui::PopID();
-                        if (add)
+
+                        // Only build the new link list when something changed
+                        if (editIndex < links.size() || add)
                         {
-                            changed = true;
-                            updatedLinks.push_back(std::string{linkText});
-                            linkText[0] = '\0';
+                            auto updatedLinks = links;
+                            if (remove)
+                                updatedLinks.erase(updatedLinks.begin() + editIndex);
+                            else if (editIndex < links.size())
+                                updatedLinks[editIndex] = appliedLink;
+                            if (add)
+                            {
+                                updatedLinks.emplace_back(linkText);
+                                linkText[0] = '\0';
+                            }
+
+                            model::SetLinks(set, anim, std::move(updatedLinks));
                         }
                     }
 
                     ImGui::Unindent();
 
                     ImGui::PopID();
+                }
+            }
+
+            ImGui::Unindent();
+        }
+
+        // Trim keys to their visible pixels to cut overdraw
+        if (ImGui::CollapsingHeader("Trim"))
+        {
+            auto trimAll = ImGui::Button("Trim all");
+            ImGui::SameLine();
+            auto untrimAll = ImGui::Button("Untrim all");
+
+            // Animations sharing a texture only read it back once
+            pixels::Sheet sheet{};
+            trim::Report total{};
+            if (ImGui::BeginTable("Trim", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+            {
+                ImGui::TableSetupColumn("Animation");
+                ImGui::TableSetupColumn("Keys");
+                ImGui::TableSetupColumn("Pixels");
+                ImGui::TableSetupColumn("Saved");
+                ImGui::TableSetupColumn("");
+                ImGui::TableHeadersRow();
+                for (const auto &anim : set.anims)
+                {
+                    auto name = anim.name;
+                    ImGui::PushID(name);
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(name);
 
-                    if (changed)
+                    auto report = trim::reports.find(anim.section);
+                    ImGui::TableNextColumn();
+                    if (report != trim::reports.end())
                     {
-                        configChanged = orxTRUE;
-                        config::SetAnimLinks(animSetName, name, updatedLinks);
+                        const auto &result = report->second;
+                        ImGui::Text("%u", result.frames);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%llu / %llu", (unsigned long long)result.trimmedPixels, (unsigned long long)result.cellPixels);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.1f%%", 100.0 * (1.0 - (double)result.trimmedPixels / orxMAX(result.cellPixels, 1ull)));
+                        total.frames += result.frames;
+                        total.cellPixels += result.cellPixels;
+                        total.trimmedPixels += result.trimmedPixels;
                     }
+                    else
+                    {
+                        ImGui::TextDisabled("-");
+                        ImGui::TableNextColumn();
+                        ImGui::TableNextColumn();
+                    }
+
+                    ImGui::TableNextColumn();
+                    if (ImGui::SmallButton("Trim") || trimAll)
+                    {
+                        if (trim::Apply(sheet, animSetName, name) == orxSTATUS_SUCCESS)
+                            rebuild::MarkAnim(name);
+                        else
+                            orxLOG("Can't trim %s, its frames don't fit its texture", name);
+                        reload = true;
+                    }
+                    ImGui::SameLine();
+                    if (ImGui::SmallButton("Untrim") || untrimAll)
+                    {
+                        if (trim::Clear(animSetName, name) == orxSTATUS_SUCCESS)
+                            rebuild::MarkAnim(name);
+                        else
+                            orxLOG("Can't untrim %s, its keys are packed in an atlas", name);
+                        reload = true;
+                    }
+                    ImGui::PopID();
                 }
+                ImGui::EndTable();
             }
+            if (total.cellPixels > 0)
+                ImGui::Text("%u trimmed keys shade %.1f%% fewer pixels", total.frames,
+                            100.0 * (1.0 - (double)total.trimmedPixels / total.cellPixels));
+        }
 
-            ImGui::Unindent();
+        // Find bit-identical keys and collapse them
+        if (ImGui::CollapsingHeader("Duplicates"))
+        {
+            if (ImGui::Button("Find duplicates"))
+                dedup::Analyze(animSet);
+            ImGui::SameLine();
+            if (ImGui::Button("Collapse duplicates"))
+            {
+                dedup::Collapse(animSet);
+                reload = true;
+            }
+
+            if (const auto &report = dedup::report)
+            {
+                ImGui::Text("%u keys hashed in %.2f ms", report->keys, report->scanTime * 1000.0);
+                ImGui::Text("%u keys copy another rectangle, %.1f KiB of texture memory", report->duplicateKeys, report->duplicateBytes / 1024.0);
+                ImGui::Text("%u keys can merge into a longer key", report->mergedKeys);
+                if (report->skippedAnims > 0)
+                    ImGui::TextDisabled("%u animations skipped, not laid out in the set's texture", report->skippedAnims);
+                for (const auto &group : report->groups)
+                    ImGui::BulletText("%s", group.c_str());
+            }
+        }
+
+        // Repack this set, and optionally others, into one atlas
+        if (ImGui::CollapsingHeader("Atlas"))
+        {
+            static std::set<std::string> otherSets{};
+            static orxCHAR atlasName[128] = "";
+            static int padding = 1;
+            for (const auto &name : atlas::GetAnimSets())
+            {
+                if (name == animSetName)
+                    continue;
+                auto selected = otherSets.count(name) > 0;
+                if (ImGui::Checkbox(name.c_str(), &selected))
+                {
+                    if (selected)
+                        otherSets.insert(name);
+                    else
+                        otherSets.erase(name);
+                }
+            }
+            orxCHAR defaultName[128];
+            orxString_NPrint(defaultName, sizeof(defaultName), "%sAtlas.png", animSetName);
+            ImGui::InputTextWithHint("Atlas file", defaultName, atlasName, sizeof(atlasName));
+            ImGui::InputInt("Padding", &padding);
+            padding = orxCLAMP(padding, 0, 16);
+            if (ImGui::Button("Build atlas"))
+            {
+                std::vector<std::string> animSets{animSetName};
+                animSets.insert(animSets.end(), otherSets.begin(), otherSets.end());
+                if (atlas::Build(animSets, *atlasName != orxCHAR_NULL ? atlasName : defaultName, padding) == orxSTATUS_SUCCESS)
+                {
+                    rebuild::MarkStructural();
+                    reload = true;
+                }
+            }
+
+            if (const auto &report = atlas::report)
+            {
+                if (!report->error.empty())
+                {
+                    ImGui::TextColored({1.0f, 0.3f, 0.3f, 1.0f}, "%s", report->error.c_str());
+                }
+                else
+                {
+                    auto atlasBytes = (orxU64)report->width * report->height * sizeof(orxU32);
+                    ImGui::Text("%s: %ux%u, %u rectangles for %u keys, %.1f%% used (%.2f ms)", report->path.c_str(),
+                                report->width, report->height, report->rects, report->keys,
+                                100.0 * report->usedPixels / ((orxU64)report->width * report->height), report->packTime * 1000.0);
+                    ImGui::Text("%.1f KiB of texture memory, %.1f KiB in the source textures", atlasBytes / 1024.0, report->sourceBytes / 1024.0);
+                }
+            }
+        }
+
+        // Reachability of every animation through the set's links
+        if (ImGui::CollapsingHeader("Transitions"))
+        {
+            const auto &graph = graph::Get(animSet);
+            const auto &names = animset::GetIndex(animSet).names;
+            ImGui::Text("%u animations, %u links, %u components (%.2f ms)", graph.nodeCount, (orxU32)graph.edges.size(),
+                        (orxU32)graph.componentSizes.size(), graph.buildTime * 1000.0);
+            if (graph.unreachableCount > 0)
+                ImGui::TextColored({1.0f, 0.6f, 0.2f, 1.0f}, "%u animations unreachable from the start animations", graph.unreachableCount);
+            ImGui::Text("%u dead ends", graph.deadEndCount);
+            for (const auto &[node, destination] : graph.dangling)
+                ImGui::TextColored({1.0f, 0.3f, 0.3f, 1.0f}, "%s links to undefined %s", names[node], destination.c_str());
+
+            // Queries relative to one animation
+            static orxU32 from = 0;
+            if (from >= graph.nodeCount)
+                from = 0;
+            if (graph.nodeCount > 0 && ImGui::BeginCombo("From", names[from]))
+            {
+                for (orxU32 node = 0; node < graph.nodeCount; node++)
+                {
+                    if (ImGui::Selectable(names[node], node == from))
+                        from = node;
+                }
+                ImGui::EndCombo();
+            }
+            if (graph.nodeCount > 0)
+            {
+                for (auto edge = graph.offsets[from]; edge < graph.offsets[from + 1]; edge++)
+                {
+                    const auto &link = graph.edges[edge];
+                    ImGui::BulletText("%s, priority %d%s%s", names[link.to], link.priority,
+                                      link.immediate ? ", immediate" : "", link.clearTarget ? ", clears target" : "");
+                }
+            }
+
+            auto flags = ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY;
+            if (graph.nodeCount > 0 && ImGui::BeginTable("Transitions", 5, flags, {0.0f, 300.0f}))
+            {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableSetupColumn("Animation");
+                ImGui::TableSetupColumn("Component");
+                ImGui::TableSetupColumn("From selected");
+                ImGui::TableSetupColumn("Dead end");
+                ImGui::TableSetupColumn("Shortest path from start");
+                ImGui::TableHeadersRow();
+                // Sets can have thousands of animations, only visible rows are drawn
+                ImGuiListClipper clipper;
+                clipper.Begin(graph.nodeCount);
+                while (clipper.Step())
+                {
+                    for (auto node = clipper.DisplayStart; node < clipper.DisplayEnd; node++)
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(names[node]);
+                        ImGui::TableNextColumn();
+                        auto component = graph.components[node];
+                        ImGui::Text("%u (%u)", component, graph.componentSizes[component]);
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(graph.CanReach(from, node) ? "reachable" : "-");
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(graph.deadEnds[node] ? "yes" : "");
+                        ImGui::TableNextColumn();
+                        if (graph.IsReachable(node))
+                        {
+                            // Dropped before the frame ends, so it can live in the frame
+                            // arena. Drawing it may grow the window's draw list, which
+                            // has to stay out of the arena.
+                            ImGuiTextBuffer path{};
+                            orxImGui_PushFrameAllocations();
+                            for (auto step : graph.GetPathFromStart(node))
+                            {
+                                if (!path.empty())
+                                    path.append(" > ");
+                                path.append(names[step]);
+                            }
+                            orxImGui_PopFrameAllocations();
+                            ImGui::TextUnformatted(path.begin(), path.end());
+                        }
+                        else
+                        {
+                            ImGui::TextDisabled("unreachable");
+                        }
+                    }
+                }
+                ImGui::EndTable();
+            }
         }
 
         // Show source texture
@@ -481,16 +5117,64 @@ namespace gui
             static auto snap = true;
             ImGui::Checkbox("Snap tooltip to frame size", &snap);
 
-            // Capture IO (mouse) information
-            ImGuiIO &io = ImGui::GetIO();
-            ImVec2 pos = ImGui::GetCursorScreenPos();
-
-            auto texture = orxTexture_Get(orxConfig_GetString("Texture"));
+            auto texture = orxTexture_Get(set.texture.c_str());
             float textureWidth, textureHeight;
             orxTexture_GetSize(texture, &textureWidth, &textureHeight);
             auto textureID = (ImTextureID)orxTexture_GetBitmap(texture);
+
+            // Frame grid detected from the texture's alpha channel
+            const auto &detected = grid::Get(texture);
+            if (detected.cellWidth == 0)
+            {
+                ImGui::TextDisabled("No frame grid detected");
+            }
+            else
+            {
+                ImGui::Text("Detected %ux%u cells, %u columns, %u rows, %u frames, %u empty (%.2f ms)",
+                            detected.cellWidth, detected.cellHeight, detected.columns, detected.rows,
+                            detected.GetFrames(), detected.emptyCells, detected.scanTime * 1000.0);
+
+                // Fill an animation from the whole grid or from a single row
+                static orxS32 gridRow = -1;
+                static size_t gridTarget = 0;
+                auto &anims = set.anims;
+                gridRow = orxCLAMP(gridRow, -1, (orxS32)detected.rows - 1);
+                if (!anims.empty())
+                    gridTarget = orxMIN(gridTarget, anims.size() - 1);
+                ImGui::SliderInt("Grid row", &gridRow, -1, detected.rows - 1, gridRow < 0 ? "All" : "%d");
+                if (!anims.empty() && ImGui::BeginCombo("Grid animation", anims[gridTarget].name))
+                {
+                    for (size_t i = 0; i < anims.size(); i++)
+                        if (ImGui::Selectable(anims[i].name, i == gridTarget))
+                            gridTarget = i;
+                    ImGui::EndCombo();
+                }
+                if (!anims.empty() && ImGui::Button("Apply grid"))
+                {
+                    auto &anim = anims[gridTarget];
+                    frameSize.fX = detected.cellWidth;
+                    frameSize.fY = detected.cellHeight;
+                    model::SetFrameSize(set, frameSize);
+                    model::SetFrames(set, anim, detected.GetFrames(gridRow));
+
+                    orxVECTOR gridOrigin = {0.0f, gridRow < 0 ? 0.0f : (orxFLOAT)(gridRow * detected.cellHeight), 0.0f};
+                    model::SetTextureOrigin(anim, gridOrigin);
+                    orxCHAR gridSize[64];
+                    orxString_NPrint(gridSize, sizeof(gridSize), "(%u, %u, 0)", detected.columns * detected.cellWidth,
+                                     (gridRow < 0 ? detected.rows : 1) * detected.cellHeight);
+                    model::SetTextureSize(anim, gridSize);
+                }
+                ImGui::SameLine();
+                if (ImGui::Button("Rescan"))
+                    grid::Invalidate(texture);
+            }
+
             ImGui::Image(textureID, {textureWidth, textureHeight});
 
+            // Capture IO (mouse) information, relative to where the image was drawn
+            ImGuiIO &io = ImGui::GetIO();
+            ImVec2 pos = ImGui::GetItemRectMin();
+
             // Zoomed in tooltip - based on imgui_demo.cpp
             if (ImGui::IsItemHovered())
             {
@@ -524,6 +5208,12 @@ namespace gui
                 {
                     regionY = textureHeight - frameSize.fY;
                 }
+                if (detected.cellWidth != 0)
+                {
+                    auto column = (orxU32)((io.MousePos.x - pos.x) / detected.cellWidth);
+                    auto row = (orxU32)((io.MousePos.y - pos.y) / detected.cellHeight);
+                    ImGui::Text("Cell (%u, %u)%s", column, row, detected.IsOccupied(column, row) ? "" : " - empty");
+                }
                 ImGui::Text("Min: (%.2f, %.2f)", regionX, regionY);
                 ImGui::Text("Max: (%.2f, %.2f)", regionX + frameSize.fX, regionY + frameSize.fY);
                 ImVec2 uv0 = ImVec2((regionX) / textureWidth, (regionY) / textureHeight);
@@ -533,9 +5223,9 @@ namespace gui
             }
         }
 
-        orxConfig_PopSection();
-
         ImGui::End();
+        if (reload)
+            model::Invalidate();
     }
 
     void ScaleInput(orxOBJECT *object)
@@ -578,16 +5268,14 @@ namespace gui
         if (ImGui::BeginCombo("Target animation", targetAnimation))
         {
             // Get animation section prefix, if there is one
-            auto animSetName = std::string{object::GetAnimSetName(object)};
-            orxASSERT(animSetName.length() > 0);
+            orxASSERT(orxString_GetLength(object::GetAnimSetName(object)) > 0);
 
             // Get the animation set for the object
-            auto animations = object::GetAnims(object);
+            const auto &index = animset::GetIndex(object::GetAnimSet(object));
 
-            for (auto anim : animations)
+            for (auto animName : index.names)
             {
                 // Add a selector for each available animation
-                auto animName = orxAnim_GetName(anim);
                 auto active = selectedAnimation == animName;
                 if (ImGui::Selectable(animName, active))
                 {
@@ -602,8 +5290,120 @@ namespace gui
         }
     }
 
+    void StatsWindow()
+    {
+        PROFILE_SCOPE("gui::StatsWindow");
+        ImGui::Begin("Stats");
+
+        ImGui::Text("Allocations");
+        ImGui::LabelText("App", "%u (%u bytes)", memory::lastFrameAllocationCount, memory::lastFrameAllocationSize);
+        ImGui::LabelText("ImGui", "%u (%u bytes)", sstImGui.u32LastFrameAllocationCount, sstImGui.u32LastFrameAllocationSize);
+        ImGui::LabelText("Steady frame", "%s", memory::lastFrameSteady ? "yes" : "no");
+        ImGui::LabelText("ImGui allocator", "%s, %.3f us", memory::allocatorNames[sstImGui.eAllocator], sstImGui.dLastFrameAllocatorTime * 1e6);
+
+        ImGui::Separator();
+        ImGui::Text("Renderer");
+        ImGui::LabelText("Draw commands", "%u", sstImGui.u32CommandCount);
+        ImGui::LabelText("Draw calls", "%u", sstImGui.u32DrawCallCount);
+        ImGui::LabelText("Culled triangles", "%u", sstImGui.u32CulledTriangleCount);
+
+        if (memory::benchmarkFrames > 0 && ImGui::CollapsingHeader("Allocator benchmark"))
+        {
+            if (memory::IsBenchmarking())
+                ImGui::Text("Running: frame %u/%u", memory::benchmarkFrame, memory::benchmarkFrames * (1 + orxIMGUI_ALLOCATOR_NUMBER));
+            for (orxU32 i = 0; i < orxIMGUI_ALLOCATOR_NUMBER; i++)
+            {
+                const auto &result = memory::benchmarkResults[i];
+                if (result.frameCount > 0)
+                    ImGui::LabelText(memory::allocatorNames[i], "%.3f us/frame, %.3f us max", result.totalTime * 1e6 / result.frameCount, result.maxTime * 1e6);
+            }
+        }
+
+        if (!stress::counts.empty() && ImGui::CollapsingHeader("Stress test"))
+        {
+            if (stress::running)
+            {
+                ImGui::Text("Running: %u objects, frame %u/%u", stress::counts[stress::step], stress::stepFrame, stress::warmupFrames + stress::framesPerStep);
+                if (ImGui::Button("Stop"))
+                    stress::Stop();
+            }
+            else if (ImGui::Button("Start"))
+            {
+                stress::Start();
+            }
+            if (ImGui::BeginTable("StressResults", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+            {
+                ImGui::TableSetupColumn("Objects");
+                ImGui::TableSetupColumn("Update (ms)");
+                ImGui::TableSetupColumn("Render (ms)");
+                ImGui::TableSetupColumn("Frame (ms)");
+                ImGui::TableSetupColumn("Max frame (ms)");
+                ImGui::TableHeadersRow();
+                for (const auto &result : stress::results)
+                {
+                    auto frames = orxMAX(1u, result.frameCount);
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", result.count);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", result.updateTime * 1e3 / frames);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", result.renderTime * 1e3 / frames);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", result.frameTime * 1e3 / frames);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", result.maxFrameTime * 1e3);
+                }
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+
+#ifdef __orxPROFILER__
+    // Per-marker timings over the last frames, see profiler::Update
+    void ProfilerWindow()
+    {
+        ImGui::Begin("Profiler");
+        ImGui::Text("Last %u frames", profiler::historyCount);
+        if (ImGui::BeginTable("Markers", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+        {
+            ImGui::TableSetupColumn("Marker");
+            ImGui::TableSetupColumn("Calls");
+            ImGui::TableSetupColumn("Min (ms)");
+            ImGui::TableSetupColumn("Avg (ms)");
+            ImGui::TableSetupColumn("Max (ms)");
+            ImGui::TableSetupColumn("History");
+            ImGui::TableHeadersRow();
+            for (orxU32 i = 0; i < profiler::markerCount; i++)
+            {
+                const auto &marker = profiler::markers[i];
+                ImGui::PushID(i);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(profiler::markerNames[i]);
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", marker.pushCount);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", marker.min);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", marker.average);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", marker.max);
+                ImGui::TableNextColumn();
+                auto offset = profiler::historyCount == profiler::historySize ? profiler::historyOffset : 0;
+                ImGui::PlotLines("##History", marker.history, profiler::historyCount, offset, nullptr, 0.0f, marker.max, ImVec2(160.0f, 24.0f));
+                ImGui::PopID();
+            }
+            ImGui::EndTable();
+        }
+        ImGui::End();
+    }
+#endif
+
     void ObjectWindow(orxOBJECT *object)
     {
+        PROFILE_SCOPE("gui::ObjectWindow");
         orxASSERT(object);
         orxCHAR title[256];
         orxString_NPrint(title, sizeof(title), "Object: %s", orxObject_GetName(object));
@@ -615,6 +5415,7 @@ namespace gui
         AnimationRateInput(object);
         ImGui::LabelText("AnimationSet name", "%s", object::GetAnimSetName(targetObject));
         TargetAnimationCombo(object);
+        ImGui::LabelText("Rebuilds", "%u patched, %u re-created, %u avoided", rebuild::patchCount, rebuild::recreateCount, rebuild::avoidedCount);
 
         ImGui::End();
     }
@@ -624,40 +5425,49 @@ namespace gui
  */
 void orxFASTCALL Update(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
-    // Re-create the object if configuration has changed
-    if (configChanged)
-    {
-        configChanged = orxFALSE;
-        // Get some animation information for the current object so we can
-        // propagate it to the replacement object.
-        auto currentAnimation = orxObject_GetCurrentAnim(targetObject);
-        auto targetAnimation = orxObject_GetTargetAnim(targetObject);
-        auto animationTime = orxObject_GetAnimTime(targetObject);
+    PROFILE_SCOPE("Update");
 
-        // Delete to current object so that the associated animset is freed
-        // now, rather than potentially delaying the deletion until the next
-        // frame. Then we can create a new object using the update config
-        // values.
-        orxObject_Delete(targetObject);
+    // Per-frame allocation accounting
+    memory::EndFrame();
+    memory::UpdateBenchmark();
+    stress::Update();
+#ifdef __orxPROFILER__
+    profiler::Update();
+#endif
+    auto changed = rebuild::IsPending() || save.has_value();
 
-        // Create a new object and align its animation and animation time to
-        // the values for the previous target object.
-        targetObject = orxObject_CreateFromConfig(objectName);
-        orxObject_SetCurrentAnim(targetObject, currentAnimation);
-        orxObject_SetTargetAnim(targetObject, targetAnimation);
-        orxObject_SetAnimTime(targetObject, animationTime);
-        orxASSERT(targetObject);
+    // Patch or re-create the object once configuration changes have settled
+    if (rebuild::IsPending() && rebuild::IsSettled())
+    {
+        targetObject = rebuild::Apply(targetObject);
     }
 
     // Save our changes if requested
     if (save.has_value())
     {
         config::Save(save.value().data(), targetObject);
+        save.reset();
     }
 
     // Show top level windows
     gui::ObjectWindow(targetObject);
     gui::AnimSetWindow(object::GetAnimSet(targetObject));
+    if (memory::showOverlay || memory::benchmarkFrames > 0 || !stress::counts.empty())
+    {
+        gui::StatsWindow();
+    }
+    if (memory::IsBenchmarking())
+    {
+        ImGui::ShowDemoWindow();
+    }
+#ifdef __orxPROFILER__
+    gui::ProfilerWindow();
+#endif
+    memory::UpdateSteady(changed);
+
+    // Drop to a low tick rate when nobody is using the editor
+    idle::Update(changed || rebuild::IsPending() || sstImGui.bInputChanged || ImGui::IsAnyItemActive() || ImGui::GetIO().WantTextInput ||
+                 memory::IsBenchmarking() || stress::running || object::IsAnimating(targetObject));
 
     // Should quit?
     if (orxInput_IsActive("Quit"))
@@ -665,6 +5475,7 @@ void orxFASTCALL Update(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
         // Send close event
         orxEvent_SendShort(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_CLOSE);
     }
+
 }
 
 /** Init function, it is called when all orx's modules have been initialized
@@ -674,6 +5485,17 @@ orxSTATUS orxFASTCALL Init()
     // Initialize Dear ImGui
     orxImGui_Init();
 
+    // Load editor settings
+    rebuild::Init();
+    reload::Init();
+    memory::Init();
+    memory::InitBenchmark();
+    idle::Init();
+    trace::Init();
+#ifdef __orxPROFILER__
+    profiler::Init();
+#endif
+
     // Create the viewport
     orxViewport_CreateFromConfig("MainViewport");
 
@@ -681,6 +5503,9 @@ orxSTATUS orxFASTCALL Init()
     targetObject = orxObject_CreateFromConfig(objectName);
     orxASSERT(targetObject);
 
+    // Stress test, when configured
+    stress::Init();
+
     // Register the Update function to the core clock
     orxClock_Register(orxClock_Get(orxCLOCK_KZ_CORE), Update, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_NORMAL);
 
@@ -700,6 +5525,15 @@ orxSTATUS orxFASTCALL Run()
  */
 void orxFASTCALL Exit()
 {
+    // Flush saves still waiting for a worker
+    saver::Exit();
+
+    // Restore the core clock and stop polling for wake-ups
+    idle::Exit();
+    reload::Exit();
+    stress::Exit();
+    trace::Exit();
+
     // Exit from Dear ImGui
     orxImGui_Exit();
 
@@ -717,10 +5551,21 @@ orxSTATUS orxFASTCALL Bootstrap()
     return orxSTATUS_SUCCESS;
 }
 
+#ifndef __animtesterBENCH__
+
 /** Main function
  */
 int main(int argc, char **argv)
 {
+    // Command-line checks of animation sets
+    for (int i = 1; i < argc; i++)
+    {
+        if (orxString_Compare(argv[i], "--validate") == 0)
+            return validate::Main(argc, argv);
+        if (orxString_Compare(argv[i], "--soak") == 0)
+            return soak::Main(argc, argv);
+    }
+
     // Set the bootstrap function to provide at least one resource storage before loading any config files
     orxConfig_SetBootstrap(Bootstrap);
 
@@ -730,3 +5575,5 @@ int main(int argc, char **argv)
     // Done!
     return EXIT_SUCCESS;
 }
+
+#endif // __animtesterBENCH__